@@ -2,16 +2,26 @@
 
 from __future__ import annotations
 
+import asyncio
+import json
 import logging
-from typing import List
+import re
+import secrets
+import time
+from typing import AsyncIterator, Dict, List, Optional, Tuple
 
-from fastapi import APIRouter, Depends
+from fastapi import APIRouter, Depends, HTTPException, WebSocket, WebSocketDisconnect
+from fastapi.responses import Response, StreamingResponse
 
 from ..config import settings
 from ..llm.base_client import BaseLLMClient, get_llm_client
 from ..models.chat_schemas import VRChatRequest, VRChatResponse, ChatMessage
 from ..models.session_store import get_session_history, save_to_history
-from ..tts.chatterbox_client import tts_wav_base64_async, ChatterboxTtsError
+from ..tts.chatterbox_client import (
+    tts_wav_base64_async,
+    tts_wav_bytes_async,
+    ChatterboxTtsError,
+)
 
 router = APIRouter()
 logger = logging.getLogger(__name__)
@@ -25,11 +35,282 @@ SYSTEM_PROMPT = (
 )
 
 
+# Short-lived store for binary audio handed out via /api/vr_audio/<token>
+# (audio_transport="url"). Entries are one-shot and expire quickly; this only
+# needs to bridge the gap between the chat response and the client's GET.
+_AUDIO_STORE: Dict[str, Tuple[bytes, float]] = {}
+_AUDIO_TTL_SECONDS = 60.0
+
+
+def _stash_audio(wav: bytes) -> str:
+    """Store WAV bytes under a fresh token and return the relative URL."""
+    now = time.monotonic()
+    for stale in [t for t, (_, expiry) in _AUDIO_STORE.items() if expiry < now]:
+        _AUDIO_STORE.pop(stale, None)
+
+    token = secrets.token_urlsafe(16)
+    _AUDIO_STORE[token] = (wav, now + _AUDIO_TTL_SECONDS)
+    return f"/api/vr_audio/{token}"
+
+
+async def _synthesize_audio(
+    req: VRChatRequest,
+    assistant_text: str,
+    session_id: str,
+    effective_language: str,
+) -> Tuple[str, Optional[str]]:
+    """
+    Run TTS and deliver it per the requested transport.
+
+    Returns (audio_wav_base64, audio_url); exactly one is populated on
+    success, both are empty/None when TTS fails (text-only reply).
+    """
+    try:
+        if req.audio_transport == "url":
+            wav = await tts_wav_bytes_async(assistant_text, language=effective_language)
+            return "", _stash_audio(wav)
+        audio_b64 = await tts_wav_base64_async(assistant_text, language=effective_language)
+        logger.debug(
+            "TTS succeeded for session %s (language=%s, bytes_base64_len=%d)",
+            session_id,
+            effective_language,
+            len(audio_b64),
+        )
+        return audio_b64, None
+    except ChatterboxTtsError as exc:
+        logger.warning(
+            "TTS failed for session %s (language=%s): %s",
+            session_id,
+            effective_language,
+            exc,
+        )
+    except Exception:
+        logger.exception(
+            "Unexpected TTS error for session %s (language=%s)",
+            session_id,
+            effective_language,
+        )
+    # We still return the text; Unreal can handle text-only replies.
+    return "", None
+
+
+# Sentence boundary for TTS pipelining: split after ./!/?/… followed by
+# whitespace. Deliberately simple — a missed boundary only means one longer
+# segment, never broken audio.
+_SENTENCE_SPLIT = re.compile(r"(?<=[.!?…])\s+")
+
+# Very short fragments ("Dr.", "1.", "Ok.") are merged into the next segment:
+# they synthesize poorly on their own and multiply per-request TTS overhead.
+_MIN_SENTENCE_CHARS = 25
+
+# Parallel TTS calls per reply; bounds the load a single long answer can put
+# on the TTS server while still overlapping synthesis with playback.
+_TTS_PIPELINE_CONCURRENCY = 3
+
+
+def _split_sentences(text: str) -> List[str]:
+    """Split assistant text into TTS-sized sentence segments."""
+    parts = [p for p in _SENTENCE_SPLIT.split(text) if p.strip()]
+
+    merged: List[str] = []
+    for part in parts:
+        if merged and len(merged[-1]) < _MIN_SENTENCE_CHARS:
+            merged[-1] = f"{merged[-1]} {part}"
+        else:
+            merged.append(part)
+    return merged or [text]
+
+
+async def _pipelined_audio_payloads(
+    assistant_text: str,
+    session_id: str,
+    effective_language: str,
+) -> AsyncIterator[dict]:
+    """
+    Yield ordered audio-segment frame payloads for a pipelined reply.
+
+    All sentences are handed to TTS up front (bounded by a semaphore) and the
+    results are awaited in order, so time-to-first-audio is bounded by the
+    first sentence while the rest synthesize in parallel behind it. A failed
+    segment yields empty audio rather than breaking the sequence.
+    """
+    sentences = _split_sentences(assistant_text)
+    semaphore = asyncio.Semaphore(_TTS_PIPELINE_CONCURRENCY)
+
+    async def synthesize(sentence: str) -> str:
+        async with semaphore:
+            try:
+                return await tts_wav_base64_async(sentence, language=effective_language)
+            except ChatterboxTtsError as exc:
+                logger.warning(
+                    "Pipelined TTS failed for session %s: %s", session_id, exc
+                )
+            except Exception:
+                logger.exception("Unexpected pipelined TTS error for session %s", session_id)
+            return ""
+
+    tasks = [asyncio.create_task(synthesize(s)) for s in sentences]
+    for index, task in enumerate(tasks):
+        yield {
+            "segment": index,
+            "last": index == len(tasks) - 1,
+            "audio_wav_base64": await task,
+        }
+
+
+@router.get("/vr_audio/{token}")
+async def vr_audio(token: str) -> Response:
+    """
+    One-shot raw-WAV download for audio_transport="url" replies.
+
+    The token is consumed on first fetch and expires after a short TTL.
+    """
+    entry = _AUDIO_STORE.pop(token, None)
+    if entry is None or entry[1] < time.monotonic():
+        raise HTTPException(status_code=404, detail="Audio token unknown or expired")
+    return Response(content=entry[0], media_type="audio/wav")
+
+
+def _sse_frame(payload: dict) -> str:
+    """Encode one Server-Sent-Events data frame."""
+    return f"data: {json.dumps(payload)}\n\n"
+
+
+async def _vr_chat_stream(
+    req: VRChatRequest,
+    llm: BaseLLMClient,
+    messages: List[ChatMessage],
+    session_id: str,
+    effective_language: str,
+) -> AsyncIterator[str]:
+    """
+    SSE generator for streamed chat: one {"delta": ...} frame per LLM chunk,
+    then a final {"done": true, ...} frame carrying the full text and the TTS
+    audio (TTS can only start once the full reply is known).
+    """
+    assistant_text = ""
+    async for delta in llm.generate_stream(messages):
+        assistant_text += delta
+        yield _sse_frame({"delta": delta})
+
+    user_msg = ChatMessage(role="user", content=req.user_text)
+    assistant_msg = ChatMessage(role="assistant", content=assistant_text)
+    await save_to_history(session_id, [user_msg, assistant_msg])
+
+    if req.pipeline_tts:
+        async for payload in _pipelined_audio_payloads(
+            assistant_text, session_id, effective_language
+        ):
+            yield _sse_frame(payload)
+        yield _sse_frame(
+            {
+                "done": True,
+                "assistant_text": assistant_text,
+                "audio_wav_base64": "",
+                "audio_url": None,
+            }
+        )
+        return
+
+    audio_b64, audio_url = await _synthesize_audio(
+        req, assistant_text, session_id, effective_language
+    )
+
+    yield _sse_frame(
+        {
+            "done": True,
+            "assistant_text": assistant_text,
+            "audio_wav_base64": audio_b64,
+            "audio_url": audio_url,
+        }
+    )
+
+
+@router.websocket("/vr_chat_ws")
+async def vr_chat_ws(
+    websocket: WebSocket,
+    llm: BaseLLMClient = Depends(get_llm_client),
+) -> None:
+    """
+    Persistent full-duplex chat channel for the Unreal GatewayWebSocket mode.
+
+    The client opens one connection per session and sends each utterance as a
+    JSON text frame in the VRChatRequest shape. Replies reuse the SSE frame
+    payloads: zero or more {"delta": ...} frames while the LLM streams (when
+    the request sets "stream": true), then one {"done": true, ...} frame with
+    the full text and the TTS audio. Malformed frames get an {"error": ...}
+    frame and the connection stays open.
+    """
+    await websocket.accept()
+    try:
+        while True:
+            raw = await websocket.receive_text()
+            try:
+                req = VRChatRequest.model_validate_json(raw)
+            except Exception as exc:  # noqa: BLE001 - reported to the client
+                await websocket.send_json({"error": f"Bad request frame: {exc}"})
+                continue
+
+            session_id = req.session_id or "default"
+            effective_language = req.language or settings.chatterbox_default_language
+
+            history: List[ChatMessage] = await get_session_history(
+                session_id=session_id,
+                max_messages=settings.session_max_history,
+            )
+            messages: List[ChatMessage] = [
+                ChatMessage(role="system", content=SYSTEM_PROMPT)
+            ]
+            messages.extend(history)
+            user_msg = ChatMessage(role="user", content=req.user_text)
+            messages.append(user_msg)
+
+            if req.stream:
+                assistant_text = ""
+                async for delta in llm.generate_stream(messages):
+                    assistant_text += delta
+                    await websocket.send_json({"delta": delta})
+            else:
+                assistant_text = await llm.generate(messages)
+
+            assistant_msg = ChatMessage(role="assistant", content=assistant_text)
+            await save_to_history(session_id, [user_msg, assistant_msg])
+
+            if req.pipeline_tts:
+                async for payload in _pipelined_audio_payloads(
+                    assistant_text, session_id, effective_language
+                ):
+                    await websocket.send_json(payload)
+                await websocket.send_json(
+                    {
+                        "done": True,
+                        "assistant_text": assistant_text,
+                        "audio_wav_base64": "",
+                        "audio_url": None,
+                    }
+                )
+                continue
+
+            audio_b64, audio_url = await _synthesize_audio(
+                req, assistant_text, session_id, effective_language
+            )
+            await websocket.send_json(
+                {
+                    "done": True,
+                    "assistant_text": assistant_text,
+                    "audio_wav_base64": audio_b64,
+                    "audio_url": audio_url,
+                }
+            )
+    except WebSocketDisconnect:
+        logger.debug("WebSocket client disconnected")
+
+
 @router.post("/vr_chat", response_model=VRChatResponse)
 async def vr_chat(
     req: VRChatRequest,
     llm: BaseLLMClient = Depends(get_llm_client),
-) -> VRChatResponse:
+):
     """
     Main chat endpoint used by the Unreal VRSecretaryComponent (Gateway mode).
 
@@ -80,6 +361,13 @@ async def vr_chat(
     user_msg = ChatMessage(role="user", content=req.user_text)
     messages.append(user_msg)
 
+    # Streamed variant: SSE deltas as the LLM generates, final frame with TTS.
+    if req.stream:
+        return StreamingResponse(
+            _vr_chat_stream(req, llm, messages, session_id, effective_language),
+            media_type="text/event-stream",
+        )
+
     # 3) Call LLM
     assistant_text = await llm.generate(messages)
     assistant_msg = ChatMessage(role="assistant", content=assistant_text)
@@ -87,38 +375,16 @@ async def vr_chat(
     # Persist conversation for this session
     await save_to_history(session_id, [user_msg, assistant_msg])
 
-    # 4) Call TTS – non-streaming, one WAV, with language support
-    audio_b64 = ""
-    try:
-        audio_b64 = await tts_wav_base64_async(
-            assistant_text,
-            # voice=None -> defaults inside chatterbox_client to DEFAULT_VOICE
-            language=effective_language,
-        )
-        logger.debug(
-            "TTS succeeded for session %s (language=%s, bytes_base64_len=%d)",
-            session_id,
-            effective_language,
-            len(audio_b64),
-        )
-    except ChatterboxTtsError as exc:
-        logger.warning(
-            "TTS failed for session %s (language=%s): %s",
-            session_id,
-            effective_language,
-            exc,
-        )
-        # We still return the text; Unreal can handle text-only replies.
-    except Exception as exc:
-        logger.exception(
-            "Unexpected TTS error for session %s (language=%s)",
-            session_id,
-            effective_language,
-        )
-        # Also fall back to text-only reply
+    # 4) Call TTS – non-streaming, one WAV, with language support. Delivered
+    #    inline as base64 or via a short-lived URL depending on the requested
+    #    audio_transport.
+    audio_b64, audio_url = await _synthesize_audio(
+        req, assistant_text, session_id, effective_language
+    )
 
     # 5) Return in the shape the Unreal plugin expects
     return VRChatResponse(
         assistant_text=assistant_text,
         audio_wav_base64=audio_b64,
+        audio_url=audio_url,
     )
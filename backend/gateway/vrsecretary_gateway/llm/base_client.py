@@ -1,7 +1,7 @@
 # backend/gateway/vrsecretary_gateway/llm/base_client.py
 
 from abc import ABC, abstractmethod
-from typing import List
+from typing import AsyncIterator, List
 
 from ..models.chat_schemas import ChatMessage
 from ..config import settings
@@ -20,6 +20,16 @@ class BaseLLMClient(ABC):
         """
         ...
 
+    async def generate_stream(self, messages: List[ChatMessage]) -> AsyncIterator[str]:
+        """
+        Yield the assistant's reply incrementally (token/chunk deltas).
+
+        Default implementation falls back to one chunk from generate(), so
+        subclasses only need to override this when the backend supports real
+        streaming.
+        """
+        yield await self.generate(messages)
+
 
 # Import concrete clients here (after BaseLLMClient is defined)
 from .ollama_client import OllamaClient  # noqa: E402
@@ -1,6 +1,7 @@
 # backend/gateway/vrsecretary_gateway/llm/ollama_client.py
 
-from typing import List
+import json
+from typing import AsyncIterator, List
 
 import httpx
 
@@ -41,3 +42,34 @@ class OllamaClient(BaseLLMClient):
             return data["choices"][0]["message"]["content"]
         except (KeyError, IndexError, TypeError) as exc:
             raise RuntimeError(f"Unexpected Ollama response shape: {data}") from exc
+
+    async def generate_stream(self, messages: List[ChatMessage]) -> AsyncIterator[str]:
+        """
+        Stream the completion as text deltas using Ollama's OpenAI-style
+        SSE streaming ("stream": true on /v1/chat/completions).
+        """
+        async with httpx.AsyncClient(
+            base_url=settings.ollama_base_url.rstrip("/"),
+            timeout=settings.ollama_timeout,
+        ) as client:
+            payload = \
+                {
+                    "model": settings.ollama_model,
+                    "messages": [m.model_dump() for m in messages],
+                    "stream": True,
+                }
+            async with client.stream("POST", "/v1/chat/completions", json=payload) as resp:
+                resp.raise_for_status()
+                async for line in resp.aiter_lines():
+                    if not line.startswith("data:"):
+                        continue
+                    chunk = line[len("data:"):].strip()
+                    if not chunk or chunk == "[DONE]":
+                        continue
+                    try:
+                        data = json.loads(chunk)
+                        delta = data["choices"][0]["delta"].get("content")
+                    except (json.JSONDecodeError, KeyError, IndexError, TypeError):
+                        continue  # skip malformed / role-only frames
+                    if delta:
+                        yield delta
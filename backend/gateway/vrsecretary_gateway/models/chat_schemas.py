@@ -42,6 +42,46 @@ class VRChatRequest(BaseModel):
         ),
         examples=["en", "it", "fr"],
     )
+    stream: bool = Field(
+        False,
+        description=(
+            "If true, the gateway answers with Server-Sent Events: one "
+            '{"delta": ...} frame per text chunk as the LLM generates, then a '
+            'final {"done": true, "assistant_text": ..., "audio_wav_base64": ...} '
+            "frame. If false (default), a single JSON VRChatResponse is returned."
+        ),
+    )
+    audio_transport: Literal["base64", "url"] = Field(
+        "base64",
+        description=(
+            'How TTS audio is delivered. "base64" (default) inlines the WAV as '
+            'audio_wav_base64 in the JSON response. "url" returns a short-lived '
+            "audio_url instead; the client GETs it once to receive the raw WAV "
+            "bytes, avoiding the ~33% base64 inflation and the decode pass."
+        ),
+    )
+    pipeline_tts: bool = Field(
+        False,
+        description=(
+            "If true (streamed transports only), the assistant text is split "
+            "into sentences and each sentence is synthesized in parallel; the "
+            'audio arrives as ordered {"segment": n, "audio_wav_base64": ...} '
+            "frames ahead of the final done frame, so playback of a long reply "
+            "starts after the first sentence instead of after the whole TTS "
+            "pass. Ignored for plain (non-streamed) requests."
+        ),
+    )
+    accepted_codecs: Optional[list[str]] = Field(
+        None,
+        description=(
+            "Audio codecs the client can decode, in preference order (e.g. "
+            '["opus", "wav"]). The gateway picks the first one its TTS '
+            "pipeline can produce and reports the choice in the response's "
+            'audio_format. Omitted or unrecognized means "wav". Opus is '
+            "~10x smaller than PCM WAV at the same voice quality."
+        ),
+        examples=[["opus", "wav"]],
+    )
 
 
 class VRChatResponse(BaseModel):
@@ -57,8 +97,27 @@ class VRChatResponse(BaseModel):
         description="Assistant's reply as plain text.",
     )
     audio_wav_base64: str = Field(
-        ...,
-        description="Base64-encoded WAV audio for TTS playback in Unreal.",
+        "",
+        description=(
+            "Base64-encoded WAV audio for TTS playback in Unreal. Empty when "
+            'audio_transport="url" was requested (see audio_url).'
+        ),
+    )
+    audio_url: Optional[str] = Field(
+        None,
+        description=(
+            "Short-lived relative URL (e.g. /api/vr_audio/<token>) serving the "
+            'raw WAV bytes once, when audio_transport="url" was requested.'
+        ),
+    )
+    audio_format: Literal["wav", "opus"] = Field(
+        "wav",
+        description=(
+            "Container/codec of the delivered audio (inline base64 or behind "
+            'audio_url). "opus" (Ogg Opus) is only chosen when the client '
+            "listed it in accepted_codecs; clients can also sniff the "
+            'container magic ("RIFF" vs "OggS").'
+        ),
     )
 
 
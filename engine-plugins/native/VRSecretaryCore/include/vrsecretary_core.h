@@ -0,0 +1,154 @@
+/*
+ * VRSecretary native client core.
+ *
+ * The hot client-side logic — request building, response parsing, base64
+ * decode, WAV header parsing and the response cache — implemented once in
+ * C++ behind a flat C ABI, so every engine integration runs the same
+ * optimized path: Unity P/Invokes this library directly (managed base64 and
+ * WAV handling caused GC frame spikes on Quest), and the Unreal module keeps
+ * a source-level twin of these routines (see VRSecretaryJsonFields and the
+ * sample game's VRSBase64) that this library is the reference for.
+ *
+ * ABI conventions:
+ *   - All strings crossing the boundary are UTF-8.
+ *   - Functions that fill a caller buffer return the REQUIRED size in bytes;
+ *     they only write when the given capacity is sufficient. Call once with
+ *     a null/zero buffer to size, then again to fill.
+ *   - Parse results are views (offset/length into the caller's buffer), so
+ *     a multi-megabyte audio payload is never copied just to locate it.
+ *   - Errors are negative return values (VRS_ERROR_*); no errno, no
+ *     exceptions across the boundary.
+ */
+
+#ifndef VRSECRETARY_CORE_H
+#define VRSECRETARY_CORE_H
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+  #define VRS_API __declspec(dllexport)
+#else
+  #define VRS_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VRS_ERROR_INVALID_ARGUMENT  (-1)
+#define VRS_ERROR_MALFORMED_INPUT   (-2)
+
+/* Request flags for vrs_build_chat_request. */
+#define VRS_REQUEST_STREAM        0x1u  /* ask for an SSE-streamed reply      */
+#define VRS_REQUEST_BINARY_AUDIO  0x2u  /* audio via short-lived URL, not b64 */
+#define VRS_REQUEST_ACCEPT_OPUS   0x4u  /* advertise opus in accepted_codecs  */
+#define VRS_REQUEST_PIPELINE_TTS  0x8u  /* sentence-pipelined TTS segments    */
+
+/* A located string value inside a caller-owned buffer (quotes excluded). */
+typedef struct vrs_string_view
+{
+    int32_t offset;      /* first value byte, or -1 when the field is absent */
+    int32_t length;      /* value length in bytes                            */
+    int32_t has_escapes; /* nonzero when the value contains backslash escapes */
+} vrs_string_view;
+
+/* Field views over a /api/vr_chat response body. */
+typedef struct vrs_response_view
+{
+    vrs_string_view assistant_text;
+    vrs_string_view audio_wav_base64;
+    vrs_string_view audio_url;
+} vrs_response_view;
+
+/* Parsed WAV format and payload location. */
+typedef struct vrs_wav_info
+{
+    int32_t sample_rate;
+    int32_t num_channels;
+    int32_t bits_per_sample;
+    int32_t data_offset;  /* first PCM byte                                   */
+    int32_t data_size;    /* PCM bytes, clamped to what the buffer holds      */
+} vrs_wav_info;
+
+/*
+ * Serialize a /api/vr_chat request body. language may be null/empty (the
+ * gateway then applies its default). Returns the required size in bytes
+ * (no terminator); writes only when out_capacity is sufficient.
+ */
+VRS_API int32_t vrs_build_chat_request(const char* session_id,
+                                       const char* user_text,
+                                       const char* language,
+                                       uint32_t flags,
+                                       char* out_utf8,
+                                       int32_t out_capacity);
+
+/*
+ * Locate the reply fields in a raw response body without building a DOM.
+ * Absent fields get offset -1. Returns 0, or VRS_ERROR_* on bad arguments.
+ * This is a scanner for the gateway's known flat response shape, not a
+ * general JSON parser.
+ */
+VRS_API int32_t vrs_parse_chat_response(const uint8_t* body,
+                                        int32_t length,
+                                        vrs_response_view* out_view);
+
+/*
+ * Resolve JSON backslash escapes in a value (use when has_escapes is set).
+ * Returns the required size; writes only when capacity is sufficient.
+ */
+VRS_API int32_t vrs_json_unescape(const uint8_t* src,
+                                  int32_t length,
+                                  uint8_t* dst,
+                                  int32_t capacity);
+
+/*
+ * Decode standard base64 (padding required, no whitespace). Returns the
+ * decoded size; writes only when capacity is sufficient. Malformed input
+ * returns VRS_ERROR_MALFORMED_INPUT.
+ */
+VRS_API int32_t vrs_base64_decode(const char* src,
+                                  int32_t length,
+                                  uint8_t* dst,
+                                  int32_t capacity);
+
+/*
+ * Parse a PCM16 WAV header (RIFF/WAVE, fmt before data, unknown chunks
+ * skipped). A declared data size past the end of the buffer — common from
+ * chunked TTS writers — is clamped, matching the engine-side decoders.
+ * Returns 0, or VRS_ERROR_MALFORMED_INPUT.
+ */
+VRS_API int32_t vrs_wav_parse(const uint8_t* data,
+                              int32_t length,
+                              vrs_wav_info* out_info);
+
+/*
+ * Byte-budgeted LRU cache of finished replies keyed by UTF-8 string
+ * (typically user text + language). Thread-safe. Entries hold assistant
+ * text and decoded audio; the least recently used entries are evicted when
+ * the budget is exceeded.
+ */
+typedef struct vrs_cache vrs_cache;
+
+VRS_API vrs_cache* vrs_cache_create(int64_t capacity_bytes);
+VRS_API void vrs_cache_destroy(vrs_cache* cache);
+
+VRS_API void vrs_cache_put(vrs_cache* cache,
+                           const char* key,
+                           const uint8_t* text_utf8, int32_t text_length,
+                           const uint8_t* audio, int32_t audio_length);
+
+/*
+ * Look up a key. Returns 1 on hit, 0 on miss. On a hit the required sizes
+ * are always stored through text_length/audio_length; the buffers are only
+ * written when their capacities are sufficient (size with nulls first).
+ */
+VRS_API int32_t vrs_cache_get(vrs_cache* cache,
+                              const char* key,
+                              uint8_t* text_out, int32_t text_capacity, int32_t* text_length,
+                              uint8_t* audio_out, int32_t audio_capacity, int32_t* audio_length);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* VRSECRETARY_CORE_H */
@@ -0,0 +1,558 @@
+#include "vrsecretary_core.h"
+
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /* ---------------------------------------------------------------- JSON */
+
+    /* Append s to out with JSON string escaping. */
+    void AppendEscaped(std::string& out, const char* s)
+    {
+        if (!s)
+        {
+            return;
+        }
+        for (const char* p = s; *p; ++p)
+        {
+            const unsigned char c = (unsigned char)*p;
+            switch (c)
+            {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b";  break;
+            case '\f': out += "\\f";  break;
+            case '\n': out += "\\n";  break;
+            case '\r': out += "\\r";  break;
+            case '\t': out += "\\t";  break;
+            default:
+                if (c < 0x20)
+                {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                }
+                else
+                {
+                    out += (char)c;
+                }
+            }
+        }
+    }
+
+    /*
+     * Locate "name":"value" in a flat JSON object, scanning raw bytes. Sets
+     * offset -1 when absent or null. Mirrors the Unreal module's
+     * VRSecretaryJson::FindStringField.
+     */
+    void FindStringField(const uint8_t* data, int32_t num, const char* name, vrs_string_view* out)
+    {
+        out->offset = -1;
+        out->length = 0;
+        out->has_escapes = 0;
+
+        const int32_t nameLen = (int32_t)std::strlen(name);
+
+        for (int32_t i = 0; i + nameLen + 3 < num; ++i)
+        {
+            if (data[i] != '"' || std::memcmp(data + i + 1, name, (size_t)nameLen) != 0 ||
+                data[i + 1 + nameLen] != '"')
+            {
+                continue;
+            }
+
+            int32_t pos = i + nameLen + 2;
+            while (pos < num && (data[pos] == ' ' || data[pos] == '\t' ||
+                                 data[pos] == '\r' || data[pos] == '\n'))
+            {
+                ++pos;
+            }
+            if (pos >= num || data[pos] != ':')
+            {
+                continue;
+            }
+            ++pos;
+            while (pos < num && (data[pos] == ' ' || data[pos] == '\t' ||
+                                 data[pos] == '\r' || data[pos] == '\n'))
+            {
+                ++pos;
+            }
+            if (pos >= num || data[pos] != '"')
+            {
+                return; /* null or non-string value */
+            }
+            ++pos;
+
+            const int32_t valueStart = pos;
+            int32_t hasEscapes = 0;
+            while (pos < num)
+            {
+                if (data[pos] == '\\')
+                {
+                    hasEscapes = 1;
+                    pos += 2;
+                    continue;
+                }
+                if (data[pos] == '"')
+                {
+                    out->offset = valueStart;
+                    out->length = pos - valueStart;
+                    out->has_escapes = hasEscapes;
+                    return;
+                }
+                ++pos;
+            }
+            return; /* unterminated */
+        }
+    }
+
+    /* -------------------------------------------------------------- base64 */
+
+    const int8_t* Base64Table()
+    {
+        static int8_t table[256];
+        static bool initialized = false;
+        if (!initialized)
+        {
+            std::memset(table, -1, sizeof(table));
+            const char* alphabet =
+                "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            for (int i = 0; i < 64; ++i)
+            {
+                table[(unsigned char)alphabet[i]] = (int8_t)i;
+            }
+            initialized = true;
+        }
+        return table;
+    }
+
+    /* ---------------------------------------------------------------- LRU  */
+
+    struct CacheEntry
+    {
+        std::string key;
+        std::vector<uint8_t> text;
+        std::vector<uint8_t> audio;
+
+        int64_t SizeBytes() const
+        {
+            return (int64_t)(key.size() + text.size() + audio.size());
+        }
+    };
+}
+
+struct vrs_cache
+{
+    explicit vrs_cache(int64_t capacity) : capacityBytes(capacity) {}
+
+    std::mutex mutex;
+    int64_t capacityBytes;
+    int64_t usedBytes = 0;
+
+    /* Most recently used at the front. */
+    std::list<CacheEntry> entries;
+    std::unordered_map<std::string, std::list<CacheEntry>::iterator> index;
+
+    void EvictOverBudget()
+    {
+        while (usedBytes > capacityBytes && !entries.empty())
+        {
+            const CacheEntry& oldest = entries.back();
+            usedBytes -= oldest.SizeBytes();
+            index.erase(oldest.key);
+            entries.pop_back();
+        }
+    }
+};
+
+extern "C" {
+
+int32_t vrs_build_chat_request(const char* session_id,
+                               const char* user_text,
+                               const char* language,
+                               uint32_t flags,
+                               char* out_utf8,
+                               int32_t out_capacity)
+{
+    if (!session_id || !user_text)
+    {
+        return VRS_ERROR_INVALID_ARGUMENT;
+    }
+
+    std::string body;
+    body.reserve(std::strlen(user_text) + 128);
+
+    body += "{\"session_id\":\"";
+    AppendEscaped(body, session_id);
+    body += "\",\"user_text\":\"";
+    AppendEscaped(body, user_text);
+    body += '"';
+
+    if (language && *language)
+    {
+        body += ",\"language\":\"";
+        AppendEscaped(body, language);
+        body += '"';
+    }
+    if (flags & VRS_REQUEST_STREAM)
+    {
+        body += ",\"stream\":true";
+    }
+    if (flags & VRS_REQUEST_PIPELINE_TTS)
+    {
+        body += ",\"pipeline_tts\":true";
+    }
+    if (flags & VRS_REQUEST_BINARY_AUDIO)
+    {
+        body += ",\"audio_transport\":\"url\"";
+    }
+    if (flags & VRS_REQUEST_ACCEPT_OPUS)
+    {
+        body += ",\"accepted_codecs\":[\"opus\",\"wav\"]";
+    }
+    body += '}';
+
+    const int32_t required = (int32_t)body.size();
+    if (out_utf8 && out_capacity >= required)
+    {
+        std::memcpy(out_utf8, body.data(), (size_t)required);
+    }
+    return required;
+}
+
+int32_t vrs_parse_chat_response(const uint8_t* body,
+                                int32_t length,
+                                vrs_response_view* out_view)
+{
+    if (!body || length <= 0 || !out_view)
+    {
+        return VRS_ERROR_INVALID_ARGUMENT;
+    }
+
+    FindStringField(body, length, "assistant_text", &out_view->assistant_text);
+    FindStringField(body, length, "audio_wav_base64", &out_view->audio_wav_base64);
+    FindStringField(body, length, "audio_url", &out_view->audio_url);
+    return 0;
+}
+
+int32_t vrs_json_unescape(const uint8_t* src,
+                          int32_t length,
+                          uint8_t* dst,
+                          int32_t capacity)
+{
+    if (!src || length < 0)
+    {
+        return VRS_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* Two passes share one loop: when dst is too small, keep counting. */
+    int32_t out = 0;
+    for (int32_t i = 0; i < length; ++i)
+    {
+        uint8_t c = src[i];
+        if (c == '\\' && i + 1 < length)
+        {
+            const uint8_t next = src[++i];
+            switch (next)
+            {
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'u':
+            {
+                if (i + 4 >= length)
+                {
+                    return VRS_ERROR_MALFORMED_INPUT;
+                }
+                uint32_t code = 0;
+                for (int32_t d = 1; d <= 4; ++d)
+                {
+                    const uint8_t h = src[i + d];
+                    code <<= 4;
+                    if (h >= '0' && h <= '9') { code |= (uint32_t)(h - '0'); }
+                    else if (h >= 'a' && h <= 'f') { code |= (uint32_t)(h - 'a' + 10); }
+                    else if (h >= 'A' && h <= 'F') { code |= (uint32_t)(h - 'A' + 10); }
+                    else { return VRS_ERROR_MALFORMED_INPUT; }
+                }
+                i += 4;
+
+                /* Encode the code point as UTF-8 (BMP only; surrogate pairs
+                 * never appear in gateway output, which is already UTF-8). */
+                if (code < 0x80)
+                {
+                    if (dst && out < capacity) { dst[out] = (uint8_t)code; }
+                    ++out;
+                }
+                else if (code < 0x800)
+                {
+                    if (dst && out + 1 < capacity)
+                    {
+                        dst[out] = (uint8_t)(0xC0 | (code >> 6));
+                        dst[out + 1] = (uint8_t)(0x80 | (code & 0x3F));
+                    }
+                    out += 2;
+                }
+                else
+                {
+                    if (dst && out + 2 < capacity)
+                    {
+                        dst[out] = (uint8_t)(0xE0 | (code >> 12));
+                        dst[out + 1] = (uint8_t)(0x80 | ((code >> 6) & 0x3F));
+                        dst[out + 2] = (uint8_t)(0x80 | (code & 0x3F));
+                    }
+                    out += 3;
+                }
+                continue;
+            }
+            default: c = next; break; /* \" \\ \/ */
+            }
+        }
+        if (dst && out < capacity)
+        {
+            dst[out] = c;
+        }
+        ++out;
+    }
+    return out;
+}
+
+int32_t vrs_base64_decode(const char* src,
+                          int32_t length,
+                          uint8_t* dst,
+                          int32_t capacity)
+{
+    if (!src || length < 0)
+    {
+        return VRS_ERROR_INVALID_ARGUMENT;
+    }
+    if (length == 0)
+    {
+        return 0;
+    }
+    if ((length & 3) != 0)
+    {
+        return VRS_ERROR_MALFORMED_INPUT;
+    }
+
+    int32_t padding = 0;
+    if (src[length - 1] == '=') { ++padding; }
+    if (length >= 2 && src[length - 2] == '=') { ++padding; }
+
+    const int32_t decoded = (length / 4) * 3 - padding;
+    if (!dst || capacity < decoded)
+    {
+        return decoded; /* size query; validity checked on the fill call */
+    }
+
+    const int8_t* table = Base64Table();
+    const uint8_t* in = (const uint8_t*)src;
+    int32_t out = 0;
+
+    for (int32_t i = 0; i < length; i += 4)
+    {
+        const int8_t a = table[in[i]];
+        const int8_t b = table[in[i + 1]];
+        const int8_t c = in[i + 2] == '=' ? 0 : table[in[i + 2]];
+        const int8_t d = in[i + 3] == '=' ? 0 : table[in[i + 3]];
+        if (a < 0 || b < 0 || c < 0 || d < 0)
+        {
+            return VRS_ERROR_MALFORMED_INPUT;
+        }
+        if ((in[i + 2] == '=' || in[i + 3] == '=') && i + 4 != length)
+        {
+            return VRS_ERROR_MALFORMED_INPUT; /* padding before the end */
+        }
+
+        const uint32_t triple =
+            ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | (uint32_t)d;
+
+        dst[out++] = (uint8_t)(triple >> 16);
+        if (in[i + 2] != '=') { dst[out++] = (uint8_t)(triple >> 8); }
+        if (in[i + 3] != '=') { dst[out++] = (uint8_t)triple; }
+    }
+    return out;
+}
+
+int32_t vrs_wav_parse(const uint8_t* data,
+                      int32_t length,
+                      vrs_wav_info* out_info)
+{
+    if (!data || !out_info)
+    {
+        return VRS_ERROR_INVALID_ARGUMENT;
+    }
+    if (length < 44 ||
+        std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0)
+    {
+        return VRS_ERROR_MALFORMED_INPUT;
+    }
+
+    auto readU32 = [data](int32_t off) -> uint32_t
+    {
+        return (uint32_t)data[off] | ((uint32_t)data[off + 1] << 8) |
+               ((uint32_t)data[off + 2] << 16) | ((uint32_t)data[off + 3] << 24);
+    };
+    auto readU16 = [data](int32_t off) -> uint16_t
+    {
+        return (uint16_t)((uint16_t)data[off] | ((uint16_t)data[off + 1] << 8));
+    };
+
+    bool haveFmt = false;
+    int32_t offset = 12;
+
+    while (offset + 8 <= length)
+    {
+        const uint32_t chunkSize = readU32(offset + 4);
+
+        if (std::memcmp(data + offset, "fmt ", 4) == 0)
+        {
+            if (chunkSize < 16 || offset + 8 + 16 > length)
+            {
+                return VRS_ERROR_MALFORMED_INPUT;
+            }
+            if (readU16(offset + 8) != 1) /* PCM only */
+            {
+                return VRS_ERROR_MALFORMED_INPUT;
+            }
+            out_info->num_channels = readU16(offset + 10);
+            out_info->sample_rate = (int32_t)readU32(offset + 12);
+            out_info->bits_per_sample = readU16(offset + 22);
+
+            if (out_info->bits_per_sample != 16 ||
+                out_info->num_channels < 1 || out_info->num_channels > 2 ||
+                out_info->sample_rate < 8000 || out_info->sample_rate > 48000)
+            {
+                return VRS_ERROR_MALFORMED_INPUT;
+            }
+            haveFmt = true;
+        }
+        else if (std::memcmp(data + offset, "data", 4) == 0)
+        {
+            if (!haveFmt)
+            {
+                return VRS_ERROR_MALFORMED_INPUT;
+            }
+            out_info->data_offset = offset + 8;
+
+            /* Clamp placeholder/overlong declared sizes to the real bytes. */
+            const int64_t declared =
+                (chunkSize == 0u || chunkSize == 0xFFFFFFFFu) ? INT64_MAX : (int64_t)chunkSize;
+            const int64_t available = (int64_t)length - (int64_t)out_info->data_offset;
+            out_info->data_size = (int32_t)(declared < available ? declared : available);
+            return 0;
+        }
+
+        if (chunkSize > (uint32_t)length) /* corrupt size; avoid overflow */
+        {
+            return VRS_ERROR_MALFORMED_INPUT;
+        }
+        offset += 8 + (int32_t)chunkSize;
+    }
+    return VRS_ERROR_MALFORMED_INPUT; /* no data chunk */
+}
+
+vrs_cache* vrs_cache_create(int64_t capacity_bytes)
+{
+    if (capacity_bytes <= 0)
+    {
+        return nullptr;
+    }
+    return new vrs_cache(capacity_bytes);
+}
+
+void vrs_cache_destroy(vrs_cache* cache)
+{
+    delete cache;
+}
+
+void vrs_cache_put(vrs_cache* cache,
+                   const char* key,
+                   const uint8_t* text_utf8, int32_t text_length,
+                   const uint8_t* audio, int32_t audio_length)
+{
+    if (!cache || !key || !*key || text_length < 0 || audio_length < 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+
+    const auto existing = cache->index.find(key);
+    if (existing != cache->index.end())
+    {
+        /* Refresh recency; the reply for a given key does not change. */
+        cache->entries.splice(cache->entries.begin(), cache->entries, existing->second);
+        return;
+    }
+
+    CacheEntry entry;
+    entry.key = key;
+    if (text_utf8 && text_length > 0)
+    {
+        entry.text.assign(text_utf8, text_utf8 + text_length);
+    }
+    if (audio && audio_length > 0)
+    {
+        entry.audio.assign(audio, audio + audio_length);
+    }
+
+    const int64_t size = entry.SizeBytes();
+    if (size > cache->capacityBytes)
+    {
+        return; /* larger than the whole budget */
+    }
+
+    cache->entries.push_front(std::move(entry));
+    cache->index[cache->entries.front().key] = cache->entries.begin();
+    cache->usedBytes += size;
+    cache->EvictOverBudget();
+}
+
+int32_t vrs_cache_get(vrs_cache* cache,
+                      const char* key,
+                      uint8_t* text_out, int32_t text_capacity, int32_t* text_length,
+                      uint8_t* audio_out, int32_t audio_capacity, int32_t* audio_length)
+{
+    if (!cache || !key)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+
+    const auto found = cache->index.find(key);
+    if (found == cache->index.end())
+    {
+        return 0;
+    }
+
+    cache->entries.splice(cache->entries.begin(), cache->entries, found->second);
+    const CacheEntry& entry = cache->entries.front();
+
+    if (text_length)
+    {
+        *text_length = (int32_t)entry.text.size();
+    }
+    if (audio_length)
+    {
+        *audio_length = (int32_t)entry.audio.size();
+    }
+    if (text_out && text_capacity >= (int32_t)entry.text.size() && !entry.text.empty())
+    {
+        std::memcpy(text_out, entry.text.data(), entry.text.size());
+    }
+    if (audio_out && audio_capacity >= (int32_t)entry.audio.size() && !entry.audio.empty())
+    {
+        std::memcpy(audio_out, entry.audio.data(), entry.audio.size());
+    }
+    return 1;
+}
+
+} /* extern "C" */
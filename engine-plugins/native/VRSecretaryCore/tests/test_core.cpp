@@ -0,0 +1,205 @@
+/* Unit tests for the native client core; run via ctest. */
+
+#include "vrsecretary_core.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define CHECK(expr)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if (!(expr))                                                        \
+        {                                                                   \
+            std::fprintf(stderr, "FAILED: %s (%s:%d)\n", #expr, __FILE__,   \
+                         __LINE__);                                         \
+            return 1;                                                       \
+        }                                                                   \
+    } while (0)
+
+static std::string BuildRequest(const char* session, const char* text,
+                                const char* language, uint32_t flags)
+{
+    const int32_t required = vrs_build_chat_request(session, text, language, flags, nullptr, 0);
+    std::string body((size_t)required, '\0');
+    vrs_build_chat_request(session, text, language, flags, &body[0], required);
+    return body;
+}
+
+static int TestBuildRequest()
+{
+    const std::string plain = BuildRequest("s1", "hello", "en", 0);
+    CHECK(plain == "{\"session_id\":\"s1\",\"user_text\":\"hello\",\"language\":\"en\"}");
+
+    const std::string escaped = BuildRequest("s1", "say \"hi\"\nplease", nullptr, 0);
+    CHECK(escaped.find("say \\\"hi\\\"\\nplease") != std::string::npos);
+    CHECK(escaped.find("language") == std::string::npos);
+
+    const std::string full = BuildRequest(
+        "s1", "hi", "it",
+        VRS_REQUEST_STREAM | VRS_REQUEST_BINARY_AUDIO | VRS_REQUEST_ACCEPT_OPUS |
+            VRS_REQUEST_PIPELINE_TTS);
+    CHECK(full.find("\"stream\":true") != std::string::npos);
+    CHECK(full.find("\"pipeline_tts\":true") != std::string::npos);
+    CHECK(full.find("\"audio_transport\":\"url\"") != std::string::npos);
+    CHECK(full.find("\"accepted_codecs\":[\"opus\",\"wav\"]") != std::string::npos);
+
+    CHECK(vrs_build_chat_request(nullptr, "x", nullptr, 0, nullptr, 0) ==
+          VRS_ERROR_INVALID_ARGUMENT);
+    return 0;
+}
+
+static int TestParseResponse()
+{
+    const std::string body =
+        "{\"assistant_text\":\"Hi\\u0041 there\",\"audio_wav_base64\":\"QUJD\","
+        "\"audio_url\":null}";
+
+    vrs_response_view view;
+    CHECK(vrs_parse_chat_response((const uint8_t*)body.data(), (int32_t)body.size(), &view) == 0);
+
+    CHECK(view.assistant_text.offset >= 0);
+    CHECK(view.assistant_text.has_escapes);
+    CHECK(view.audio_wav_base64.offset >= 0);
+    CHECK(view.audio_wav_base64.length == 4);
+    CHECK(std::memcmp(body.data() + view.audio_wav_base64.offset, "QUJD", 4) == 0);
+    CHECK(view.audio_url.offset == -1); /* null value */
+
+    /* Unescape the text view. */
+    const uint8_t* text = (const uint8_t*)body.data() + view.assistant_text.offset;
+    const int32_t needed = vrs_json_unescape(text, view.assistant_text.length, nullptr, 0);
+    std::vector<uint8_t> out((size_t)needed);
+    CHECK(vrs_json_unescape(text, view.assistant_text.length, out.data(), needed) == needed);
+    CHECK(std::string(out.begin(), out.end()) == "HiA there");
+    return 0;
+}
+
+static int TestBase64()
+{
+    const char* src = "SGVsbG8sIFZSIQ=="; /* "Hello, VR!" */
+    const int32_t size = vrs_base64_decode(src, 16, nullptr, 0);
+    CHECK(size == 10);
+
+    std::vector<uint8_t> out((size_t)size);
+    CHECK(vrs_base64_decode(src, 16, out.data(), size) == size);
+    CHECK(std::memcmp(out.data(), "Hello, VR!", 10) == 0);
+
+    uint8_t buf[16];
+    CHECK(vrs_base64_decode("QUJ!", 4, buf, 16) == VRS_ERROR_MALFORMED_INPUT);
+    CHECK(vrs_base64_decode("QUJD1", 5, buf, 16) == VRS_ERROR_MALFORMED_INPUT);
+    CHECK(vrs_base64_decode("QQ==QUJD", 8, buf, 16) == VRS_ERROR_MALFORMED_INPUT);
+    CHECK(vrs_base64_decode("", 0, buf, 16) == 0);
+    return 0;
+}
+
+static std::vector<uint8_t> MakeWav(int32_t sampleRate, int16_t channels, int32_t dataBytes,
+                                    uint32_t declaredSize)
+{
+    std::vector<uint8_t> wav;
+    auto push32 = [&wav](uint32_t v)
+    {
+        wav.push_back((uint8_t)v);
+        wav.push_back((uint8_t)(v >> 8));
+        wav.push_back((uint8_t)(v >> 16));
+        wav.push_back((uint8_t)(v >> 24));
+    };
+    auto push16 = [&wav](uint16_t v)
+    {
+        wav.push_back((uint8_t)v);
+        wav.push_back((uint8_t)(v >> 8));
+    };
+    auto pushId = [&wav](const char* id) { wav.insert(wav.end(), id, id + 4); };
+
+    pushId("RIFF");
+    push32(36 + (uint32_t)dataBytes);
+    pushId("WAVE");
+    pushId("fmt ");
+    push32(16);
+    push16(1);
+    push16((uint16_t)channels);
+    push32((uint32_t)sampleRate);
+    push32((uint32_t)(sampleRate * channels * 2));
+    push16((uint16_t)(channels * 2));
+    push16(16);
+    pushId("data");
+    push32(declaredSize);
+    wav.resize(wav.size() + (size_t)dataBytes, 0x11);
+    return wav;
+}
+
+static int TestWavParse()
+{
+    const std::vector<uint8_t> wav = MakeWav(24000, 1, 4800, 4800);
+    vrs_wav_info info;
+    CHECK(vrs_wav_parse(wav.data(), (int32_t)wav.size(), &info) == 0);
+    CHECK(info.sample_rate == 24000);
+    CHECK(info.num_channels == 1);
+    CHECK(info.bits_per_sample == 16);
+    CHECK(info.data_offset == 44);
+    CHECK(info.data_size == 4800);
+
+    /* Placeholder declared size clamps to the real bytes. */
+    const std::vector<uint8_t> streamed = MakeWav(48000, 2, 960, 0xFFFFFFFFu);
+    CHECK(vrs_wav_parse(streamed.data(), (int32_t)streamed.size(), &info) == 0);
+    CHECK(info.data_size == 960);
+
+    std::vector<uint8_t> bad = MakeWav(24000, 1, 480, 480);
+    bad[3] = 'X';
+    CHECK(vrs_wav_parse(bad.data(), (int32_t)bad.size(), &info) == VRS_ERROR_MALFORMED_INPUT);
+    CHECK(vrs_wav_parse(wav.data(), 20, &info) == VRS_ERROR_MALFORMED_INPUT);
+    return 0;
+}
+
+static int TestCache()
+{
+    vrs_cache* cache = vrs_cache_create(256);
+    CHECK(cache != nullptr);
+
+    const uint8_t textA[] = "reply A";
+    const uint8_t audioA[] = {1, 2, 3, 4};
+    vrs_cache_put(cache, "a", textA, 7, audioA, 4);
+
+    int32_t textLen = 0;
+    int32_t audioLen = 0;
+    CHECK(vrs_cache_get(cache, "a", nullptr, 0, &textLen, nullptr, 0, &audioLen) == 1);
+    CHECK(textLen == 7 && audioLen == 4);
+
+    uint8_t textOut[16];
+    uint8_t audioOut[16];
+    CHECK(vrs_cache_get(cache, "a", textOut, 16, &textLen, audioOut, 16, &audioLen) == 1);
+    CHECK(std::memcmp(textOut, "reply A", 7) == 0);
+    CHECK(std::memcmp(audioOut, audioA, 4) == 0);
+    CHECK(vrs_cache_get(cache, "missing", nullptr, 0, &textLen, nullptr, 0, &audioLen) == 0);
+
+    /* LRU eviction: touch "a", then overflow the budget with new entries. */
+    std::vector<uint8_t> big(100, 0xAA);
+    vrs_cache_put(cache, "b", nullptr, 0, big.data(), 100);
+    CHECK(vrs_cache_get(cache, "a", nullptr, 0, &textLen, nullptr, 0, &audioLen) == 1);
+    vrs_cache_put(cache, "c", nullptr, 0, big.data(), 100);
+    vrs_cache_put(cache, "d", nullptr, 0, big.data(), 100);
+
+    /* "b" was least recently used once "a" was touched. */
+    CHECK(vrs_cache_get(cache, "b", nullptr, 0, &textLen, nullptr, 0, &audioLen) == 0);
+
+    vrs_cache_destroy(cache);
+    CHECK(vrs_cache_create(0) == nullptr);
+    return 0;
+}
+
+int main()
+{
+    int failures = 0;
+    failures += TestBuildRequest();
+    failures += TestParseResponse();
+    failures += TestBase64();
+    failures += TestWavParse();
+    failures += TestCache();
+
+    if (failures == 0)
+    {
+        std::printf("All vrsecretary_core tests passed\n");
+    }
+    return failures;
+}
@@ -1 +1,29 @@
-// TODO: ChatRequest model.
+// Request model for POST /api/vr_chat. Serialized by the native core
+// (see VRSecretaryClient.BuildRequestBody), not by a managed JSON pass.
+
+namespace VRSecretary
+{
+    public sealed class ChatRequest
+    {
+        /// <summary>Conversation key; the gateway keeps history per session.</summary>
+        public string SessionId;
+
+        /// <summary>What the player said or typed.</summary>
+        public string UserText;
+
+        /// <summary>BCP-47 code, e.g. "en" or "it"; null uses the gateway default.</summary>
+        public string Language;
+
+        /// <summary>Request an SSE-streamed reply instead of a single JSON body.</summary>
+        public bool Stream;
+
+        /// <summary>Receive audio as a short-lived URL instead of inline base64.</summary>
+        public bool BinaryAudioTransport;
+
+        /// <summary>Advertise Opus support; the gateway falls back to WAV.</summary>
+        public bool AcceptOpusAudio;
+
+        /// <summary>Sentence-pipelined TTS segments (streamed transports only).</summary>
+        public bool PipelineTts;
+    }
+}
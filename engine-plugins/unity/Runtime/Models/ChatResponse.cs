@@ -1 +1,17 @@
-// TODO: ChatResponse model.
+// Response model for /api/vr_chat. Produced by VRSecretaryClient.ParseResponse,
+// which decodes the audio base64 natively straight out of the body bytes.
+
+namespace VRSecretary
+{
+    public sealed class ChatResponse
+    {
+        /// <summary>The assistant's reply text.</summary>
+        public string AssistantText;
+
+        /// <summary>Decoded WAV bytes, or null when the reply carried no audio.</summary>
+        public byte[] AudioWavData;
+
+        /// <summary>Short-lived audio URL when binary transport was requested.</summary>
+        public string AudioUrl;
+    }
+}
@@ -1 +1,263 @@
-// TODO: Implement Unity HTTP client for /api/vr_chat.
+// VRSecretary Unity client.
+//
+// The hot path — request building, response parsing, base64/WAV decode and
+// the response cache — lives in the shared native core library
+// (engine-plugins/native/VRSecretaryCore), P/Invoked here. Managed C#
+// implementations of base64 and WAV handling caused GC frame spikes on
+// Quest; the native calls below allocate only the final managed buffers.
+//
+// Ship the built library with the plugin as "vrsecretary_core"
+// (vrsecretary_core.dll / libvrsecretary_core.so / .dylib).
+
+using System;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace VRSecretary
+{
+    /// <summary>Flat P/Invoke surface of the native client core.</summary>
+    internal static class NativeCore
+    {
+        private const string Dll = "vrsecretary_core";
+
+        public const uint RequestStream = 0x1;
+        public const uint RequestBinaryAudio = 0x2;
+        public const uint RequestAcceptOpus = 0x4;
+        public const uint RequestPipelineTts = 0x8;
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct StringView
+        {
+            public int Offset;
+            public int Length;
+            public int HasEscapes;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct ResponseView
+        {
+            public StringView AssistantText;
+            public StringView AudioWavBase64;
+            public StringView AudioUrl;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        public struct WavInfo
+        {
+            public int SampleRate;
+            public int NumChannels;
+            public int BitsPerSample;
+            public int DataOffset;
+            public int DataSize;
+        }
+
+        [DllImport(Dll, EntryPoint = "vrs_build_chat_request", CharSet = CharSet.Ansi)]
+        public static extern int BuildChatRequest(
+            string sessionId, string userText, string language, uint flags,
+            byte[] outUtf8, int outCapacity);
+
+        [DllImport(Dll, EntryPoint = "vrs_parse_chat_response")]
+        public static extern int ParseChatResponse(
+            byte[] body, int length, out ResponseView view);
+
+        [DllImport(Dll, EntryPoint = "vrs_json_unescape")]
+        public static extern unsafe int JsonUnescape(
+            byte* src, int length, byte[] dst, int capacity);
+
+        [DllImport(Dll, EntryPoint = "vrs_base64_decode")]
+        public static extern unsafe int Base64Decode(
+            byte* src, int length, byte[] dst, int capacity);
+
+        [DllImport(Dll, EntryPoint = "vrs_wav_parse")]
+        public static extern int WavParse(byte[] data, int length, out WavInfo info);
+
+        [DllImport(Dll, EntryPoint = "vrs_cache_create")]
+        public static extern IntPtr CacheCreate(long capacityBytes);
+
+        [DllImport(Dll, EntryPoint = "vrs_cache_destroy")]
+        public static extern void CacheDestroy(IntPtr cache);
+
+        [DllImport(Dll, EntryPoint = "vrs_cache_put")]
+        public static extern void CachePut(
+            IntPtr cache, string key,
+            byte[] textUtf8, int textLength, byte[] audio, int audioLength);
+
+        [DllImport(Dll, EntryPoint = "vrs_cache_get")]
+        public static extern int CacheGet(
+            IntPtr cache, string key,
+            byte[] textOut, int textCapacity, out int textLength,
+            byte[] audioOut, int audioCapacity, out int audioLength);
+    }
+
+    /// <summary>
+    /// Managed facade over the native core. Pair with UnityWebRequest (or any
+    /// HTTP stack): BuildRequestBody before the POST to /api/vr_chat,
+    /// ParseResponse on the downloaded bytes. The optional response cache
+    /// answers repeated phrases without a round trip.
+    /// </summary>
+    public sealed class VRSecretaryClient : IDisposable
+    {
+        private IntPtr _cache;
+
+        public VRSecretaryClient(long cacheCapacityBytes = 32 * 1024 * 1024)
+        {
+            if (cacheCapacityBytes > 0)
+            {
+                _cache = NativeCore.CacheCreate(cacheCapacityBytes);
+            }
+        }
+
+        /// <summary>Serialize a chat request body (UTF-8, ready to POST).</summary>
+        public byte[] BuildRequestBody(ChatRequest request)
+        {
+            uint flags = 0;
+            if (request.Stream) flags |= NativeCore.RequestStream;
+            if (request.BinaryAudioTransport) flags |= NativeCore.RequestBinaryAudio;
+            if (request.AcceptOpusAudio) flags |= NativeCore.RequestAcceptOpus;
+            if (request.PipelineTts) flags |= NativeCore.RequestPipelineTts;
+
+            int required = NativeCore.BuildChatRequest(
+                request.SessionId, request.UserText, request.Language, flags, null, 0);
+            if (required < 0)
+            {
+                throw new ArgumentException("session_id and user_text are required");
+            }
+
+            var body = new byte[required];
+            NativeCore.BuildChatRequest(
+                request.SessionId, request.UserText, request.Language, flags, body, required);
+            return body;
+        }
+
+        /// <summary>
+        /// Parse a /api/vr_chat response body. The audio base64 is decoded
+        /// natively straight out of the body bytes — no managed substring,
+        /// no managed base64 pass.
+        /// </summary>
+        public unsafe ChatResponse ParseResponse(byte[] body)
+        {
+            if (body == null || body.Length == 0)
+            {
+                throw new ArgumentException("Empty response body");
+            }
+            if (NativeCore.ParseChatResponse(body, body.Length, out var view) != 0)
+            {
+                throw new ArgumentException("Malformed response body");
+            }
+
+            var response = new ChatResponse
+            {
+                AssistantText = ReadString(body, view.AssistantText),
+                AudioUrl = ReadString(body, view.AudioUrl),
+            };
+
+            if (view.AudioWavBase64.Offset >= 0 && view.AudioWavBase64.Length > 0)
+            {
+                fixed (byte* p = &body[view.AudioWavBase64.Offset])
+                {
+                    int size = NativeCore.Base64Decode(p, view.AudioWavBase64.Length, null, 0);
+                    if (size > 0)
+                    {
+                        var audio = new byte[size];
+                        if (NativeCore.Base64Decode(p, view.AudioWavBase64.Length, audio, size) == size)
+                        {
+                            response.AudioWavData = audio;
+                        }
+                    }
+                }
+            }
+            return response;
+        }
+
+        /// <summary>
+        /// Parse WAV bytes into interleaved PCM16 plus format, for an
+        /// AudioClip via AudioClip.SetData after a short→float convert.
+        /// Returns false on malformed input.
+        /// </summary>
+        public static bool TryParseWav(byte[] wav, out int sampleRate, out int channels,
+                                       out ArraySegment<byte> pcm)
+        {
+            sampleRate = 0;
+            channels = 0;
+            pcm = default;
+
+            if (wav == null || NativeCore.WavParse(wav, wav.Length, out var info) != 0)
+            {
+                return false;
+            }
+            sampleRate = info.SampleRate;
+            channels = info.NumChannels;
+            pcm = new ArraySegment<byte>(wav, info.DataOffset, info.DataSize);
+            return true;
+        }
+
+        /// <summary>Store a finished reply under a cache key.</summary>
+        public void CacheStore(string key, string assistantText, byte[] audioWav)
+        {
+            if (_cache == IntPtr.Zero || string.IsNullOrEmpty(key))
+            {
+                return;
+            }
+            byte[] text = Encoding.UTF8.GetBytes(assistantText ?? string.Empty);
+            NativeCore.CachePut(_cache, key, text, text.Length,
+                                audioWav, audioWav?.Length ?? 0);
+        }
+
+        /// <summary>Look up a cached reply; null on miss.</summary>
+        public ChatResponse CacheLookup(string key)
+        {
+            if (_cache == IntPtr.Zero || string.IsNullOrEmpty(key))
+            {
+                return null;
+            }
+            if (NativeCore.CacheGet(_cache, key, null, 0, out int textLen,
+                                    null, 0, out int audioLen) == 0)
+            {
+                return null;
+            }
+
+            var text = new byte[textLen];
+            var audio = new byte[audioLen];
+            NativeCore.CacheGet(_cache, key, text, textLen, out _, audio, audioLen, out _);
+
+            return new ChatResponse
+            {
+                AssistantText = Encoding.UTF8.GetString(text),
+                AudioWavData = audioLen > 0 ? audio : null,
+            };
+        }
+
+        public void Dispose()
+        {
+            if (_cache != IntPtr.Zero)
+            {
+                NativeCore.CacheDestroy(_cache);
+                _cache = IntPtr.Zero;
+            }
+        }
+
+        private static unsafe string ReadString(byte[] body, NativeCore.StringView view)
+        {
+            if (view.Offset < 0 || view.Length <= 0)
+            {
+                return string.Empty;
+            }
+            if (view.HasEscapes == 0)
+            {
+                return Encoding.UTF8.GetString(body, view.Offset, view.Length);
+            }
+
+            fixed (byte* p = &body[view.Offset])
+            {
+                int size = NativeCore.JsonUnescape(p, view.Length, null, 0);
+                if (size <= 0)
+                {
+                    return string.Empty;
+                }
+                var buffer = new byte[size];
+                NativeCore.JsonUnescape(p, view.Length, buffer, size);
+                return Encoding.UTF8.GetString(buffer);
+            }
+        }
+    }
+}
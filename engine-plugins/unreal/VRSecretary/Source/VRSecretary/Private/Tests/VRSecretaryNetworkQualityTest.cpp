@@ -0,0 +1,106 @@
+#include "Misc/AutomationTest.h"
+
+#include "VRSecretaryNetworkQuality.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * The adaptive quality controller turns static per-venue config into a
+ * feedback loop, so its classification and adaptation math is worth pinning
+ * down: a misread tier silently flips codecs and transports in production.
+ * This drives a private controller instance through synthetic request
+ * histories — LAN-clean, lossy, bandwidth-starved, recovering — and checks
+ * the tier plus every derived knob at each stage.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSecretaryNetworkQualityAdaptation,
+    "VRSecretary.Transport.NetworkQualityAdaptation",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+    EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FVRSecretaryNetworkQualityAdaptation::RunTest(const FString& Parameters)
+{
+    const float BaseTimeout = 10.0f;
+    const float BaseHedge = 2.0f;
+
+    FVRSecretaryNetworkQuality Quality;
+
+    // Fresh controller: no samples, no opinions, no adaptation.
+    TestTrue(TEXT("Starts Unknown"),
+             Quality.GetTier() == EVRSecretaryNetworkTier::Unknown);
+    TestEqual(TEXT("Unknown leaves timeout alone"),
+              Quality.AdaptTimeoutSeconds(BaseTimeout), BaseTimeout);
+    TestEqual(TEXT("Unknown leaves hedge threshold alone"),
+              Quality.AdaptHedgeThresholdSeconds(BaseHedge), BaseHedge);
+
+    // LAN-class link: fast round trips, bulk payloads at ~2.6 MB/s.
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        Quality.RecordSuccess(/*RttMs=*/100.0f, /*PayloadBytes=*/256 * 1024);
+    }
+    TestTrue(TEXT("Fast reliable link classifies Good"),
+             Quality.GetTier() == EVRSecretaryNetworkTier::Good);
+    TestFalse(TEXT("Good link keeps PCM audio"), Quality.ShouldPreferCompressedAudio());
+    TestFalse(TEXT("Good link keeps non-streamed replies"), Quality.ShouldPreferStreaming());
+    TestEqual(TEXT("Good link keeps the history budget"),
+              Quality.AdaptHistoryTokenBudget(4000), 4000);
+    TestEqual(TEXT("Good link keeps the configured timeout"),
+              Quality.AdaptTimeoutSeconds(BaseTimeout), BaseTimeout);
+
+    // Completion times sit around 100 ms with no jitter, so the hedge
+    // threshold should tighten well below the venue-worst-case config.
+    const float TightHedge = Quality.AdaptHedgeThresholdSeconds(BaseHedge);
+    TestTrue(TEXT("Steady fast link tightens the hedge threshold"),
+             TightHedge < BaseHedge && TightHedge >= 0.05f);
+
+    // The link turns lossy: failure EWMA (alpha 0.2) crosses the Poor
+    // threshold after four consecutive failures from a clean slate.
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Quality.RecordFailure();
+    }
+    TestTrue(TEXT("Lossy link classifies Poor"),
+             Quality.GetTier() == EVRSecretaryNetworkTier::Poor);
+    TestTrue(TEXT("Poor link prefers compressed audio"), Quality.ShouldPreferCompressedAudio());
+    TestTrue(TEXT("Poor link prefers streamed replies"), Quality.ShouldPreferStreaming());
+    TestEqual(TEXT("Poor link halves the history budget"),
+              Quality.AdaptHistoryTokenBudget(4000), 2000);
+    TestEqual(TEXT("Poor link caps an unlimited history budget"),
+              Quality.AdaptHistoryTokenBudget(0), 2048);
+
+    // Requests succeed again but run long (slow venue, big answers): the
+    // failure EWMA decays back under the Good threshold while the measured
+    // completion time pushes the timeout out — bounded at 3x the base.
+    for (int32 Index = 0; Index < 13; ++Index)
+    {
+        Quality.RecordSuccess(/*RttMs=*/20000.0f, /*PayloadBytes=*/0);
+    }
+    TestTrue(TEXT("Recovered link classifies Good again"),
+             Quality.GetTier() == EVRSecretaryNetworkTier::Good);
+    const float SlowTimeout = Quality.AdaptTimeoutSeconds(BaseTimeout);
+    TestTrue(TEXT("Routinely slow completions extend the timeout"),
+             SlowTimeout > BaseTimeout);
+    TestTrue(TEXT("Extended timeout is capped at 3x the base"),
+             SlowTimeout <= BaseTimeout * 3.0f);
+    TestEqual(TEXT("Hedge threshold never exceeds the configured base"),
+              Quality.AdaptHedgeThresholdSeconds(BaseHedge), BaseHedge);
+
+    // Bandwidth starvation without a single failure: 100 KB in 2 s is
+    // ~50 KB/s, under the Poor throughput floor.
+    FVRSecretaryNetworkQuality Starved;
+    for (int32 Index = 0; Index < 6; ++Index)
+    {
+        Starved.RecordSuccess(/*RttMs=*/2000.0f, /*PayloadBytes=*/100 * 1024);
+    }
+    TestTrue(TEXT("Bandwidth-starved link classifies Poor without failures"),
+             Starved.GetTier() == EVRSecretaryNetworkTier::Poor);
+
+    // Reset forgets everything.
+    Starved.Reset();
+    TestTrue(TEXT("Reset returns to Unknown"),
+             Starved.GetTier() == EVRSecretaryNetworkTier::Unknown);
+    TestEqual(TEXT("Reset clears the sample count"), Starved.GetNumSamples(), 0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
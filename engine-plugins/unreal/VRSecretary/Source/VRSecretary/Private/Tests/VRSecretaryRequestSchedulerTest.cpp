@@ -0,0 +1,95 @@
+#include "Misc/AutomationTest.h"
+
+#include "UObject/Package.h"
+#include "VRSecretaryRequestScheduler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * The scheduler's prefetch lane promises two things: prefetches dispatch
+ * behind every queued interactive entry regardless of priority, and they
+ * leave one concurrency slot free for interactive arrivals whenever the
+ * budget allows it. Drives a scheduler instance with counting dispatch
+ * lambdas instead of real HTTP and checks both.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSecretaryRequestSchedulerPrefetchLane,
+    "VRSecretary.Transport.RequestSchedulerPrefetchLane",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+    EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FVRSecretaryRequestSchedulerPrefetchLane::RunTest(const FString& Parameters)
+{
+    // A fresh transient scheduler; the default budget of 4 from the class
+    // initializer applies (Initialize is not run, so settings stay out of it).
+    UVRSecretaryRequestScheduler* Scheduler =
+        NewObject<UVRSecretaryRequestScheduler>(GetTransientPackage());
+    UObject* Owner = GetTransientPackage();
+
+    TArray<FString> DispatchOrder;
+    auto Dispatch = [&DispatchOrder](const FString& Name)
+    {
+        return [&DispatchOrder, Name]() -> bool
+        {
+            DispatchOrder.Add(Name);
+            return true;
+        };
+    };
+
+    // Fill the budget so everything below queues instead of running.
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Scheduler->Enqueue(Owner, 0, Dispatch(FString::Printf(TEXT("warm%d"), Index)));
+    }
+    TestEqual(TEXT("Budget filled"), Scheduler->GetNumActiveRequests(), 4);
+    DispatchOrder.Reset();
+
+    // Queue a prefetch first, then interactive entries at assorted
+    // priorities: the prefetch must still dispatch last.
+    Scheduler->EnqueuePrefetch(Owner, Dispatch(TEXT("prefetch")));
+    Scheduler->Enqueue(Owner, -5, Dispatch(TEXT("low")));
+    Scheduler->Enqueue(Owner, 10, Dispatch(TEXT("high")));
+    TestEqual(TEXT("All queued while saturated"), Scheduler->GetNumQueuedRequests(), 3);
+
+    // Drain: each finish frees one slot. The first two go to the interactive
+    // entries by priority; the prefetch then waits one extra finish because
+    // it refuses the last free slot (budget 4, active 3 after two finishes).
+    Scheduler->NotifyRequestFinished();
+    Scheduler->NotifyRequestFinished();
+    TestEqual(TEXT("Interactive entries dispatched first"), DispatchOrder.Num(), 2);
+    TestEqual(TEXT("Highest priority first"), DispatchOrder[0], FString(TEXT("high")));
+    TestEqual(TEXT("Lower priority second"), DispatchOrder[1], FString(TEXT("low")));
+    TestEqual(TEXT("Prefetch still queued at full budget"), Scheduler->GetNumQueuedRequests(), 1);
+
+    Scheduler->NotifyRequestFinished();
+    TestEqual(TEXT("Prefetch keeps the last slot free"), Scheduler->GetNumQueuedRequests(), 1);
+
+    Scheduler->NotifyRequestFinished();
+    TestEqual(TEXT("Prefetch dispatches once a spare slot exists"), Scheduler->GetNumQueuedRequests(), 0);
+    TestEqual(TEXT("Prefetch ran last"), DispatchOrder.Last(), FString(TEXT("prefetch")));
+
+    // CancelQueued drops interactive entries but leaves prefetches queued.
+    while (Scheduler->GetNumActiveRequests() > 0)
+    {
+        Scheduler->NotifyRequestFinished();
+    }
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Scheduler->Enqueue(Owner, 0, Dispatch(FString::Printf(TEXT("refill%d"), Index)));
+    }
+    Scheduler->Enqueue(Owner, 0, Dispatch(TEXT("doomed")));
+    Scheduler->EnqueuePrefetch(Owner, Dispatch(TEXT("survivor")));
+    TestEqual(TEXT("One of each queued"), Scheduler->GetNumQueuedRequests(), 2);
+
+    Scheduler->CancelQueued(Owner);
+    TestEqual(TEXT("Interactive entry cancelled, prefetch kept"), Scheduler->GetNumQueuedRequests(), 1);
+
+    DispatchOrder.Reset();
+    Scheduler->NotifyRequestFinished();
+    Scheduler->NotifyRequestFinished();
+    TestEqual(TEXT("Surviving prefetch dispatched"), DispatchOrder.Num(), 1);
+    TestEqual(TEXT("Survivor is the prefetch"), DispatchOrder[0], FString(TEXT("survivor")));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,88 @@
+#include "Misc/AutomationTest.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "VRSecretaryRequestTemplate.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * The precompiled request template replaced per-send DOM serialization; the
+ * gateway contract lives in the bytes, so this replays representative key
+ * and user-text combinations and checks the spliced body parses back to
+ * exactly the fields the DOM path used to emit.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSecretaryRequestTemplateReplay,
+    "VRSecretary.Transport.RequestTemplateReplay",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+    EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FVRSecretaryRequestTemplateReplay::RunTest(const FString& Parameters)
+{
+    FVRSecretaryRequestTemplateKey Key;
+    Key.SessionId = TEXT("npc-07");
+    Key.Language = TEXT("en");
+
+    FVRSecretaryRequestTemplate Template;
+    Template.EnsureCompiled(Key);
+
+    auto ParseBody = [this](const FString& Body) -> TSharedPtr<FJsonObject>
+    {
+        TSharedPtr<FJsonObject> Parsed;
+        const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
+        TestTrue(TEXT("Body is valid JSON"), FJsonSerializer::Deserialize(Reader, Parsed) && Parsed.IsValid());
+        return Parsed;
+    };
+
+    // Minimal key: exactly the three always-present fields.
+    {
+        const TSharedPtr<FJsonObject> Parsed = ParseBody(Template.BuildBody(TEXT("hello")));
+        TestEqual(TEXT("session_id"), Parsed->GetStringField(TEXT("session_id")), FString(TEXT("npc-07")));
+        TestEqual(TEXT("user_text"), Parsed->GetStringField(TEXT("user_text")), FString(TEXT("hello")));
+        TestEqual(TEXT("language"), Parsed->GetStringField(TEXT("language")), FString(TEXT("en")));
+        TestEqual(TEXT("No optional fields"), Parsed->Values.Num(), 3);
+    }
+
+    // User text needing escapes survives the splice round trip.
+    {
+        const FString Tricky = TEXT("say \"hi\"\n\tplease \\ done");
+        const TSharedPtr<FJsonObject> Parsed = ParseBody(Template.BuildBody(Tricky));
+        TestEqual(TEXT("Escaped user_text round trips"), Parsed->GetStringField(TEXT("user_text")), Tricky);
+    }
+
+    // All flags on: field set matches the historical DOM output.
+    {
+        Key.bStream = true;
+        Key.bPipelineTts = true;
+        Key.bBinaryAudioTransport = true;
+        Key.bAcceptOpus = true;
+        Template.EnsureCompiled(Key);
+
+        const TSharedPtr<FJsonObject> Parsed = ParseBody(Template.BuildBody(TEXT("hi")));
+        TestTrue(TEXT("stream"), Parsed->GetBoolField(TEXT("stream")));
+        TestTrue(TEXT("pipeline_tts"), Parsed->GetBoolField(TEXT("pipeline_tts")));
+        TestEqual(TEXT("audio_transport"), Parsed->GetStringField(TEXT("audio_transport")), FString(TEXT("url")));
+
+        const TArray<TSharedPtr<FJsonValue>>* Codecs = nullptr;
+        TestTrue(TEXT("accepted_codecs present"), Parsed->TryGetArrayField(TEXT("accepted_codecs"), Codecs));
+        if (Codecs)
+        {
+            TestEqual(TEXT("Two codecs"), Codecs->Num(), 2);
+            TestEqual(TEXT("Opus leads"), (*Codecs)[0]->AsString(), FString(TEXT("opus")));
+            TestEqual(TEXT("WAV fallback"), (*Codecs)[1]->AsString(), FString(TEXT("wav")));
+        }
+    }
+
+    // Recompile triggers on a changed key, not on a changed user text.
+    {
+        Key.Language = TEXT("it");
+        Template.EnsureCompiled(Key);
+        const TSharedPtr<FJsonObject> Parsed = ParseBody(Template.BuildBody(TEXT("ciao")));
+        TestEqual(TEXT("Recompiled language"), Parsed->GetStringField(TEXT("language")), FString(TEXT("it")));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
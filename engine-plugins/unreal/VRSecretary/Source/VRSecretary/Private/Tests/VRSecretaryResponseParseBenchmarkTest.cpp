@@ -0,0 +1,220 @@
+#include "VRSecretaryJsonFields.h"
+#include "VRSecretarySseStream.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Benchmark and replay harness for the response-handling hot path.
+ *
+ * HandleGatewayResponse itself needs a live IHttpResponse, so these tests
+ * drive its parsing stages directly: the raw-byte fast path
+ * (VRSecretaryJson), the JSON DOM fallback, and the incremental SSE reader —
+ * the same code the component runs on every reply. Bodies are synthesized at
+ * the sizes the gateway actually produces (the bulk being one large
+ * audio_wav_base64 string), so the numbers track the production shape.
+ *
+ * Run alongside the decode benchmarks before engine upgrades:
+ *
+ *     UnrealEditor-Cmd <project> -ExecCmds="Automation RunTests VRSecretary" \
+ *         -unattended -nopause -nullrhi
+ */
+namespace VRSecretaryParseBenchmark
+{
+    /** Synthesize a gateway reply body with AudioChars of base64 payload. */
+    TArray<uint8> MakeResponseBody(int32 AudioChars, FString& OutAssistantText)
+    {
+        OutAssistantText =
+            TEXT("Of course! I have moved the design review to Thursday at 10, ")
+            TEXT("booked the small meeting room and sent the updated invite.");
+
+        FString Audio;
+        Audio.Reserve(AudioChars);
+        const TCHAR Alphabet[] = TEXT("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef");
+        for (int32 Index = 0; Index < AudioChars; ++Index)
+        {
+            Audio.AppendChar(Alphabet[Index % 32]);
+        }
+
+        const FString Body = FString::Printf(
+            TEXT("{\"assistant_text\":\"%s\",\"audio_wav_base64\":\"%s\",\"audio_url\":null}"),
+            *OutAssistantText, *Audio);
+
+        const FTCHARToUTF8 Utf8(*Body);
+        TArray<uint8> Bytes;
+        Bytes.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        return Bytes;
+    }
+
+    /** Nearest-rank percentile over an unsorted sample set, in place. */
+    double PercentileMs(TArray<double>& Samples, float Fraction)
+    {
+        Samples.Sort();
+        const int32 Index = FMath::Clamp(
+            (int32)(Fraction * Samples.Num()), 0, Samples.Num() - 1);
+        return Samples[Index] * 1000.0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSecretaryResponseParseBenchmark,
+    "VRSecretary.Transport.ResponseParseBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+    EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter)
+
+bool FVRSecretaryResponseParseBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace VRSecretaryParseBenchmark;
+
+    constexpr int32 Iterations = 30;
+    const int32 AudioSizes[] = { 64 * 1024, 512 * 1024, 2 * 1024 * 1024 };
+
+    for (const int32 AudioChars : AudioSizes)
+    {
+        FString ExpectedText;
+        const TArray<uint8> Body = MakeResponseBody(AudioChars, ExpectedText);
+
+        TArray<double> FastPathSeconds;
+        TArray<double> DomSeconds;
+        FastPathSeconds.Reserve(Iterations);
+        DomSeconds.Reserve(Iterations);
+
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            // Fast path: locate both fields in the raw bytes, convert only
+            // the text (the component hands the audio view to base64 decode
+            // without ever building a TCHAR copy of it).
+            {
+                const double Start = FPlatformTime::Seconds();
+                VRSecretaryJson::FStringFieldView TextView;
+                VRSecretaryJson::FStringFieldView AudioView;
+                VRSecretaryJson::FindStringField(Body.GetData(), Body.Num(), "assistant_text", TextView);
+                VRSecretaryJson::FindStringField(Body.GetData(), Body.Num(), "audio_wav_base64", AudioView);
+                const FString Text = VRSecretaryJson::ToString(Body.GetData(), TextView);
+                FastPathSeconds.Add(FPlatformTime::Seconds() - Start);
+
+                TestEqual(TEXT("Fast path text matches"), Text, ExpectedText);
+                TestTrue(TEXT("Fast path finds audio"), AudioView.IsSet());
+                TestEqual(TEXT("Fast path audio length"), AudioView.Length, AudioChars);
+            }
+
+            // DOM fallback: full TCHAR conversion plus FJsonSerializer, the
+            // path taken for bodies under the fast-path size threshold.
+            {
+                const double Start = FPlatformTime::Seconds();
+                const FUTF8ToTCHAR Converter((const ANSICHAR*)Body.GetData(), Body.Num());
+                const FString BodyString(Converter.Length(), Converter.Get());
+
+                TSharedPtr<FJsonObject> JsonObject;
+                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyString);
+                const bool bParsed = FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid();
+                DomSeconds.Add(FPlatformTime::Seconds() - Start);
+
+                TestTrue(TEXT("DOM parse succeeds"), bParsed);
+            }
+        }
+
+        double FastSum = 0.0;
+        for (double Sample : FastPathSeconds)
+        {
+            FastSum += Sample;
+        }
+        const double FastMBs = (Body.Num() * (double)Iterations) / (1024.0 * 1024.0) / FastSum;
+
+        AddInfo(FString::Printf(
+            TEXT("%d KB body: fast path %.1f MB/s, p50=%.2f ms p95=%.2f ms | DOM p50=%.2f ms p95=%.2f ms"),
+            Body.Num() / 1024,
+            FastMBs,
+            PercentileMs(FastPathSeconds, 0.50f),
+            PercentileMs(FastPathSeconds, 0.95f),
+            PercentileMs(DomSeconds, 0.50f),
+            PercentileMs(DomSeconds, 0.95f)));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSecretarySseStreamReplay,
+    "VRSecretary.Transport.SseStreamReplay",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+    EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FVRSecretarySseStreamReplay::RunTest(const FString& Parameters)
+{
+    // Replay a recorded-style streamed reply through the incremental SSE
+    // reader in transport-sized chunks, including a frame boundary that
+    // falls mid-chunk, and verify framing never tears.
+    FString StreamBody;
+    FString ExpectedText;
+    for (int32 Index = 0; Index < 40; ++Index)
+    {
+        const FString Delta = FString::Printf(TEXT("token%d "), Index);
+        ExpectedText += Delta;
+        StreamBody += FString::Printf(TEXT("data: {\"delta\": \"%s\"}\n\n"), *Delta);
+    }
+    for (int32 Segment = 0; Segment < 3; ++Segment)
+    {
+        StreamBody += FString::Printf(
+            TEXT("data: {\"segment\": %d, \"last\": %s, \"audio_wav_base64\": \"QUJD\"}\n\n"),
+            Segment, Segment == 2 ? TEXT("true") : TEXT("false"));
+    }
+    StreamBody += FString::Printf(
+        TEXT("data: {\"done\": true, \"assistant_text\": \"%s\", \"audio_wav_base64\": \"\"}\n\n"),
+        *ExpectedText.TrimEnd());
+
+    const FTCHARToUTF8 Utf8(*StreamBody);
+
+    FVRSecretarySseStream Stream;
+
+    int32 DeltaCount = 0;
+    Stream.OnTextDelta = [&DeltaCount](const FString&, const FString&) { ++DeltaCount; };
+
+    int32 SegmentCount = 0;
+    int32 LastSegmentIndex = INDEX_NONE;
+    Stream.OnAudioSegment = [&](int32 SegmentIndex, bool bLast, const FString& Audio)
+    {
+        ++SegmentCount;
+        TestEqual(TEXT("Segments arrive in order"), SegmentIndex, SegmentCount - 1);
+        TestEqual(TEXT("Segment audio intact"), Audio, FString(TEXT("QUJD")));
+        if (bLast)
+        {
+            LastSegmentIndex = SegmentIndex;
+        }
+    };
+
+    FString FinalText;
+    Stream.OnFinalFrame = [&FinalText](const FString& AssistantText, const FString&, const FString&)
+    {
+        FinalText = AssistantText;
+    };
+
+    // Feed in 1 KB chunks; hold back the final 10 bytes to prove a partial
+    // done frame stays pending instead of being consumed torn.
+    const int32 TotalBytes = Utf8.Length();
+    const int32 HoldBack = 10;
+    int32 Offset = 0;
+    while (Offset < TotalBytes - HoldBack)
+    {
+        const int32 Chunk = FMath::Min(1024, TotalBytes - HoldBack - Offset);
+        Stream.Serialize((void*)((const uint8*)Utf8.Get() + Offset), Chunk);
+        Offset += Chunk;
+    }
+
+    TestEqual(TEXT("All deltas surfaced"), DeltaCount, 40);
+    TestEqual(TEXT("All segments surfaced"), SegmentCount, 3);
+    TestFalse(TEXT("Partial done frame not consumed"), Stream.ReceivedFinalFrame());
+
+    Stream.Serialize((void*)((const uint8*)Utf8.Get() + Offset), TotalBytes - Offset);
+
+    TestTrue(TEXT("Final frame consumed"), Stream.ReceivedFinalFrame());
+    TestEqual(TEXT("Last segment flagged"), LastSegmentIndex, 2);
+    TestEqual(TEXT("Final text intact"), FinalText, ExpectedText.TrimEnd());
+    TestEqual(TEXT("Accumulated text matches"), Stream.GetAccumulatedText(), ExpectedText);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,291 @@
+#include "VRSLlamaRunner.h"
+#include "VRSecretarySettings.h"
+#include "VRSecretaryLog.h"
+
+#include "HAL/PlatformProcess.h"
+#include "Misc/Paths.h"
+
+#if VRSECRETARY_WITH_LOCAL_LLAMA
+#include "llama.h"
+#endif
+
+FVRSLlamaRunner& FVRSLlamaRunner::Get()
+{
+    static FVRSLlamaRunner Instance;
+    return Instance;
+}
+
+FVRSLlamaRunner::FVRSLlamaRunner()
+    : WakeEvent()
+    , bStopRequested(false)
+    , bModelReady(false)
+{
+}
+
+FVRSLlamaRunner::~FVRSLlamaRunner()
+{
+    Shutdown();
+}
+
+bool FVRSLlamaRunner::IsAvailable() const
+{
+#if VRSECRETARY_WITH_LOCAL_LLAMA
+    return bModelReady;
+#else
+    return false;
+#endif
+}
+
+void FVRSLlamaRunner::StartupAsync()
+{
+#if VRSECRETARY_WITH_LOCAL_LLAMA
+    if (Thread)
+    {
+        return;
+    }
+
+    const UVRSecretarySettings* Settings = GetDefault<UVRSecretarySettings>();
+    if (!Settings || Settings->LocalLlamaModelPath.FilePath.IsEmpty())
+    {
+        UE_LOG(LogVRSecretary, Log,
+               TEXT("LocalLlamaCpp: no model path configured; local backend stays disabled."));
+        return;
+    }
+
+    bStopRequested = false;
+    Thread = FRunnableThread::Create(
+        this,
+        TEXT("VRSLlamaWorker"),
+        0,
+        TPri_BelowNormal);
+#else
+    UE_LOG(LogVRSecretary, Log,
+           TEXT("LocalLlamaCpp: plugin built without llama.cpp (see ThirdParty/LlamaCpp/README.txt)."));
+#endif
+}
+
+void FVRSLlamaRunner::Shutdown()
+{
+    if (Thread)
+    {
+        Stop();
+        Thread->WaitForCompletion();
+        delete Thread;
+        Thread = nullptr;
+    }
+}
+
+void FVRSLlamaRunner::Stop()
+{
+    bStopRequested = true;
+    WakeEvent->Trigger();
+}
+
+bool FVRSLlamaRunner::EnqueueRequest(FVRSLlamaRequest&& Request)
+{
+    if (!IsAvailable())
+    {
+        return false;
+    }
+
+    RequestQueue.Enqueue(MoveTemp(Request));
+    WakeEvent->Trigger();
+    return true;
+}
+
+uint32 FVRSLlamaRunner::Run()
+{
+#if VRSECRETARY_WITH_LOCAL_LLAMA
+    if (!LoadModelOnWorker())
+    {
+        return 1;
+    }
+
+    while (!bStopRequested)
+    {
+        FVRSLlamaRequest Request;
+        while (RequestQueue.Dequeue(Request))
+        {
+            if (bStopRequested)
+            {
+                break;
+            }
+            RunInference(Request);
+        }
+
+        WakeEvent->Wait();
+    }
+
+    bModelReady = false;
+
+    if (Context)
+    {
+        llama_free(Context);
+        Context = nullptr;
+    }
+    if (Model)
+    {
+        llama_free_model(Model);
+        Model = nullptr;
+    }
+    llama_backend_free();
+#endif
+    return 0;
+}
+
+#if VRSECRETARY_WITH_LOCAL_LLAMA
+
+bool FVRSLlamaRunner::LoadModelOnWorker()
+{
+    const UVRSecretarySettings* Settings = GetDefault<UVRSecretarySettings>();
+    const FString ModelPath = FPaths::ConvertRelativePathToFull(Settings->LocalLlamaModelPath.FilePath);
+
+    UE_LOG(LogVRSecretary, Log, TEXT("LocalLlamaCpp: loading model %s (mmap)"), *ModelPath);
+
+    llama_backend_init();
+
+    // use_mmap defaults to true: weights are mapped once and paged on demand
+    // instead of read-copied into the process heap.
+    llama_model_params ModelParams = llama_model_default_params();
+    Model = llama_load_model_from_file(TCHAR_TO_UTF8(*ModelPath), ModelParams);
+    if (!Model)
+    {
+        UE_LOG(LogVRSecretary, Error, TEXT("LocalLlamaCpp: failed to load model %s"), *ModelPath);
+        return false;
+    }
+
+    llama_context_params CtxParams = llama_context_default_params();
+    CtxParams.n_ctx = FMath::Max(512, Settings->LocalLlamaContextSize);
+    CtxParams.n_threads = Settings->LocalLlamaThreads > 0
+        ? Settings->LocalLlamaThreads
+        : FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 2;
+
+    Context = llama_new_context_with_model(Model, CtxParams);
+    if (!Context)
+    {
+        UE_LOG(LogVRSecretary, Error, TEXT("LocalLlamaCpp: failed to create context"));
+        llama_free_model(Model);
+        Model = nullptr;
+        return false;
+    }
+
+    bModelReady = true;
+    UE_LOG(LogVRSecretary, Log, TEXT("LocalLlamaCpp: model ready (n_ctx=%d, n_threads=%d)"),
+           (int32)CtxParams.n_ctx, (int32)CtxParams.n_threads);
+    return true;
+}
+
+void FVRSLlamaRunner::RunInference(FVRSLlamaRequest& Request)
+{
+    const FTCHARToUTF8 PromptUtf8(*Request.Prompt);
+
+    // Tokenize the prompt (two-pass: size query, then fill).
+    int32 TokenCount = -llama_tokenize(
+        llama_get_model(Context), PromptUtf8.Get(), PromptUtf8.Length(),
+        nullptr, 0, /*add_special=*/true, /*parse_special=*/true);
+    if (TokenCount <= 0)
+    {
+        if (Request.OnFailed)
+        {
+            Request.OnFailed(TEXT("LocalLlamaCpp: prompt tokenization failed"));
+        }
+        return;
+    }
+
+    TArray<llama_token> Tokens;
+    Tokens.SetNumUninitialized(TokenCount);
+    llama_tokenize(
+        llama_get_model(Context), PromptUtf8.Get(), PromptUtf8.Length(),
+        Tokens.GetData(), Tokens.Num(), true, true);
+
+    // Fresh conversation per request; session history is the component's job.
+    llama_kv_cache_clear(Context);
+
+    if (llama_decode(Context, llama_batch_get_one(Tokens.GetData(), Tokens.Num(), 0, 0)) != 0)
+    {
+        if (Request.OnFailed)
+        {
+            Request.OnFailed(TEXT("LocalLlamaCpp: prompt eval failed"));
+        }
+        return;
+    }
+
+    const int32 VocabSize = llama_n_vocab(llama_get_model(Context));
+    const float Temperature = FMath::Max(Request.Config.Temperature, 0.0f);
+    const float TopP = FMath::Clamp(Request.Config.TopP, 0.0f, 1.0f);
+
+    FString GeneratedText;
+    int32 Position = Tokens.Num();
+
+    for (int32 Generated = 0; Generated < Request.Config.MaxTokens && !bStopRequested; ++Generated)
+    {
+        float* Logits = llama_get_logits_ith(Context, -1);
+
+        // Temperature + top-p sampling over the raw logits. Greedy when the
+        // temperature is (near) zero.
+        llama_token NextToken = 0;
+        if (Temperature < KINDA_SMALL_NUMBER)
+        {
+            float Best = -FLT_MAX;
+            for (int32 Index = 0; Index < VocabSize; ++Index)
+            {
+                if (Logits[Index] > Best)
+                {
+                    Best = Logits[Index];
+                    NextToken = Index;
+                }
+            }
+        }
+        else
+        {
+            TArray<llama_token_data> Candidates;
+            Candidates.SetNumUninitialized(VocabSize);
+            for (int32 Index = 0; Index < VocabSize; ++Index)
+            {
+                Candidates[Index] = { (llama_token)Index, Logits[Index], 0.0f };
+            }
+            llama_token_data_array CandidateArray = { Candidates.GetData(), (size_t)VocabSize, false };
+
+            llama_sample_temp(Context, &CandidateArray, Temperature);
+            llama_sample_top_p(Context, &CandidateArray, TopP, 1);
+            NextToken = llama_sample_token(Context, &CandidateArray);
+        }
+
+        if (llama_token_is_eog(llama_get_model(Context), NextToken))
+        {
+            break;
+        }
+
+        // Detokenize the piece and stream it out.
+        char Piece[256];
+        const int32 PieceLen = llama_token_to_piece(
+            llama_get_model(Context), NextToken, Piece, sizeof(Piece), 0, true);
+        if (PieceLen > 0)
+        {
+            const FUTF8ToTCHAR Converter(Piece, PieceLen);
+            const FString PieceText(Converter.Length(), Converter.Get());
+            GeneratedText += PieceText;
+            if (Request.OnToken)
+            {
+                Request.OnToken(PieceText, GeneratedText);
+            }
+        }
+
+        if (llama_decode(Context, llama_batch_get_one(&NextToken, 1, Position, 0)) != 0)
+        {
+            if (Request.OnFailed)
+            {
+                Request.OnFailed(TEXT("LocalLlamaCpp: decode failed mid-generation"));
+            }
+            return;
+        }
+        ++Position;
+    }
+
+    if (Request.OnComplete)
+    {
+        Request.OnComplete(GeneratedText);
+    }
+}
+
+#endif // VRSECRETARY_WITH_LOCAL_LLAMA
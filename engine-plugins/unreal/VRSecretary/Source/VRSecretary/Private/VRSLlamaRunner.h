@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "VRSecretaryChatTypes.h"
+
+/**
+ * One queued local inference job. Callbacks are invoked on the llama worker
+ * thread; callers must marshal to the game thread themselves (the component
+ * does this via AsyncTask).
+ */
+struct FVRSLlamaRequest
+{
+    FString Prompt;
+    FVRSecretaryChatConfig Config;
+
+    /** Per generated token: (TokenText, AccumulatedText). */
+    TFunction<void(const FString&, const FString&)> OnToken;
+
+    /** Once, with the full generated text. */
+    TFunction<void(const FString&)> OnComplete;
+
+    /** Once, on failure, with an error message. */
+    TFunction<void(const FString&)> OnFailed;
+};
+
+/**
+ * Owner of the native llama.cpp model and inference context.
+ *
+ * The model is loaded once (memory-mapped — llama.cpp's default mmap load, so
+ * weights are shared between processes and paged on demand) on a dedicated
+ * worker thread started from FVRSecretaryModule::StartupModule. Inference
+ * requests are queued and served strictly on that thread; the game thread
+ * never touches llama state.
+ *
+ * Compiled out to a permanently-unavailable stub when the third-party
+ * llama.cpp headers/libs are absent (see ThirdParty/LlamaCpp/README.txt and
+ * VRSECRETARY_WITH_LOCAL_LLAMA in VRSecretary.Build.cs).
+ */
+class FVRSLlamaRunner : public FRunnable
+{
+public:
+    static FVRSLlamaRunner& Get();
+
+    /** True when compiled with llama.cpp and the model loaded successfully. */
+    bool IsAvailable() const;
+
+    /**
+     * Start the worker thread and begin loading the model from the path in
+     * UVRSecretarySettings. Safe to call more than once; subsequent calls
+     * are no-ops. Returns immediately — the load happens on the worker.
+     */
+    void StartupAsync();
+
+    /** Stop the worker, free the context and model. Called at module shutdown. */
+    void Shutdown();
+
+    /**
+     * Queue a prompt for generation. Returns false (without invoking any
+     * callback) if the runner is unavailable so callers can fall back.
+     */
+    bool EnqueueRequest(FVRSLlamaRequest&& Request);
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    FVRSLlamaRunner();
+    virtual ~FVRSLlamaRunner() override;
+
+    FRunnableThread* Thread = nullptr;
+    FEventRef WakeEvent;
+    TQueue<FVRSLlamaRequest, EQueueMode::Mpsc> RequestQueue;
+
+    FThreadSafeBool bStopRequested;
+    FThreadSafeBool bModelReady;
+
+#if VRSECRETARY_WITH_LOCAL_LLAMA
+    /** Opaque llama.cpp handles; only touched on the worker thread. */
+    struct llama_model* Model = nullptr;
+    struct llama_context* Context = nullptr;
+
+    bool LoadModelOnWorker();
+    void RunInference(FVRSLlamaRequest& Request);
+#endif
+};
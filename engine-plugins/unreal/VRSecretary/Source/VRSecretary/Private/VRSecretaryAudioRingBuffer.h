@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Single-producer single-consumer lock-free ring buffer of int16 PCM samples.
+ *
+ * The producer is the audio capture callback (audio render thread), the
+ * consumer is the game thread. Push never blocks, never allocates and never
+ * takes a lock — the performance contract the capture pipeline is built on.
+ * When the consumer falls behind, the newest samples are dropped and counted
+ * rather than stalling the audio device.
+ *
+ * Indices grow monotonically and wrap through a power-of-two mask, so the
+ * full/empty distinction needs no extra flag. Capacity is fixed after
+ * Initialize; Reset may only be called while the producer is stopped.
+ */
+class FVRSecretaryAudioRingBuffer
+{
+public:
+    /** Allocate at least MinCapacitySamples, rounded up to a power of two. */
+    void Initialize(int32 MinCapacitySamples)
+    {
+        const uint32 Capacity = FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(MinCapacitySamples, 256));
+        Buffer.SetNumUninitialized((int32)Capacity);
+        Mask = Capacity - 1;
+        WriteIndex.store(0, std::memory_order_relaxed);
+        ReadIndex.store(0, std::memory_order_relaxed);
+        DroppedSamples.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Producer side: copy in as many samples as fit, drop (and count) the
+     * rest. Safe to call from the audio render thread.
+     */
+    void Push(const int16* Samples, int32 NumSamples)
+    {
+        const uint32 Write = WriteIndex.load(std::memory_order_relaxed);
+        const uint32 Read = ReadIndex.load(std::memory_order_acquire);
+        const uint32 Free = (uint32)Buffer.Num() - (Write - Read);
+
+        const int32 ToWrite = FMath::Min(NumSamples, (int32)Free);
+        if (ToWrite < NumSamples)
+        {
+            DroppedSamples.fetch_add((uint64)(NumSamples - ToWrite), std::memory_order_relaxed);
+        }
+
+        const uint32 Start = Write & Mask;
+        const int32 FirstRun = FMath::Min(ToWrite, Buffer.Num() - (int32)Start);
+        FMemory::Memcpy(Buffer.GetData() + Start, Samples, FirstRun * sizeof(int16));
+        FMemory::Memcpy(Buffer.GetData(), Samples + FirstRun, (ToWrite - FirstRun) * sizeof(int16));
+
+        WriteIndex.store(Write + (uint32)ToWrite, std::memory_order_release);
+    }
+
+    /** Consumer side: copy out up to MaxSamples; returns the number copied. */
+    int32 Pop(int16* OutSamples, int32 MaxSamples)
+    {
+        const uint32 Read = ReadIndex.load(std::memory_order_relaxed);
+        const uint32 Write = WriteIndex.load(std::memory_order_acquire);
+        const int32 Available = (int32)(Write - Read);
+
+        const int32 ToRead = FMath::Min(MaxSamples, Available);
+        const uint32 Start = Read & Mask;
+        const int32 FirstRun = FMath::Min(ToRead, Buffer.Num() - (int32)Start);
+        FMemory::Memcpy(OutSamples, Buffer.GetData() + Start, FirstRun * sizeof(int16));
+        FMemory::Memcpy(OutSamples + FirstRun, Buffer.GetData(), (ToRead - FirstRun) * sizeof(int16));
+
+        ReadIndex.store(Read + (uint32)ToRead, std::memory_order_release);
+        return ToRead;
+    }
+
+    /** Samples dropped because the consumer fell behind (diagnostics). */
+    uint64 GetDroppedSampleCount() const
+    {
+        return DroppedSamples.load(std::memory_order_relaxed);
+    }
+
+    /** Discard buffered samples. Only valid while the producer is stopped. */
+    void Reset()
+    {
+        ReadIndex.store(WriteIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+private:
+    TArray<int16> Buffer;
+    uint32 Mask = 0;
+
+    std::atomic<uint32> WriteIndex{0};
+    std::atomic<uint32> ReadIndex{0};
+    std::atomic<uint64> DroppedSamples{0};
+};
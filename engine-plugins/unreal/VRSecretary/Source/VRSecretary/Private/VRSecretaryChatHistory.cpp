@@ -0,0 +1,160 @@
+#include "VRSecretaryChatHistory.h"
+
+FVRSecretaryChatHistory::FVRSecretaryChatHistory(int32 InMaxTurns, int32 InTokenBudget)
+    : MaxTurns(FMath::Max(1, InMaxTurns))
+    , TokenBudget(InTokenBudget)
+{
+    Turns.SetNum(MaxTurns);
+}
+
+void FVRSecretaryChatHistory::AddTurn(const FString& Role, const FString& Content)
+{
+    if (Count == MaxTurns)
+    {
+        // Full: overwrite the oldest slot and advance the head.
+        Head = (Head + 1) % MaxTurns;
+        --Count;
+    }
+
+    FVRSChatTurn& Slot = Turns[(Head + Count) % MaxTurns];
+    Slot.Role = Role;
+    Slot.Content = Content;
+    ++Count;
+
+    TrimToBudget();
+    bPrefixDirty = true;
+}
+
+void FVRSecretaryChatHistory::Reset()
+{
+    Head = 0;
+    Count = 0;
+    bPrefixDirty = true;
+}
+
+void FVRSecretaryChatHistory::SetTokenBudget(int32 InTokenBudget)
+{
+    if (TokenBudget == InTokenBudget)
+    {
+        return;
+    }
+    TokenBudget = InTokenBudget;
+
+    const int32 CountBefore = Count;
+    TrimToBudget();
+    if (Count != CountBefore)
+    {
+        bPrefixDirty = true;
+    }
+}
+
+void FVRSecretaryChatHistory::Serialize(FArchive& Ar)
+{
+    if (Ar.IsLoading())
+    {
+        int32 NumSaved = 0;
+        Ar << NumSaved;
+        Reset();
+        for (int32 Index = 0; Index < NumSaved && !Ar.IsError(); ++Index)
+        {
+            FString Role;
+            FString Content;
+            Ar << Role;
+            Ar << Content;
+            AddTurn(Role, Content);
+        }
+    }
+    else
+    {
+        int32 NumSaved = Count;
+        Ar << NumSaved;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            FVRSChatTurn& Turn = Turns[(Head + Index) % MaxTurns];
+            Ar << Turn.Role;
+            Ar << Turn.Content;
+        }
+    }
+}
+
+void FVRSecretaryChatHistory::TrimToBudget()
+{
+    if (TokenBudget <= 0)
+    {
+        return; // Unlimited.
+    }
+
+    int32 Tokens = 0;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Tokens += EstimateTokens(Turns[(Head + Index) % MaxTurns].Content);
+    }
+
+    while (Count > 0 && Tokens > TokenBudget)
+    {
+        Tokens -= EstimateTokens(Turns[Head].Content);
+        Head = (Head + 1) % MaxTurns;
+        --Count;
+    }
+}
+
+FString FVRSecretaryChatHistory::SerializeStringValue(const FString& Value)
+{
+    FString Out;
+    Out.Reserve(Value.Len() + 2);
+    Out += TEXT("\"");
+    for (const TCHAR Ch : Value)
+    {
+        switch (Ch)
+        {
+        case TEXT('"'):  Out += TEXT("\\\""); break;
+        case TEXT('\\'): Out += TEXT("\\\\"); break;
+        case TEXT('\n'): Out += TEXT("\\n");  break;
+        case TEXT('\r'): Out += TEXT("\\r");  break;
+        case TEXT('\t'): Out += TEXT("\\t");  break;
+        default:
+            if (Ch < 0x20)
+            {
+                Out += FString::Printf(TEXT("\\u%04x"), (int32)Ch);
+            }
+            else
+            {
+                Out.AppendChar(Ch);
+            }
+        }
+    }
+    Out += TEXT("\"");
+    return Out;
+}
+
+FString FVRSecretaryChatHistory::SerializeMessageObject(const FString& Role, const FString& Content)
+{
+    return FString::Printf(TEXT("{\"role\":%s,\"content\":%s}"),
+                           *SerializeStringValue(Role),
+                           *SerializeStringValue(Content));
+}
+
+const TArray<uint8>& FVRSecretaryChatHistory::GetEncodedPrefixUtf8(const FString& SystemPrompt)
+{
+    if (!bPrefixDirty && CachedSystemPrompt == SystemPrompt)
+    {
+        return EncodedPrefix;
+    }
+
+    FString Prefix = TEXT("\"messages\":[");
+    Prefix += SerializeMessageObject(TEXT("system"), SystemPrompt);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FVRSChatTurn& Turn = Turns[(Head + Index) % MaxTurns];
+        Prefix += TEXT(",");
+        Prefix += SerializeMessageObject(Turn.Role, Turn.Content);
+    }
+
+    const FTCHARToUTF8 Utf8(*Prefix);
+    EncodedPrefix.SetNumUninitialized(Utf8.Length());
+    FMemory::Memcpy(EncodedPrefix.GetData(), Utf8.Get(), Utf8.Length());
+
+    CachedSystemPrompt = SystemPrompt;
+    bPrefixDirty = false;
+    return EncodedPrefix;
+}
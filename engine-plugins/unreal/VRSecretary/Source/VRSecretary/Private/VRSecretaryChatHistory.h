@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One past conversation turn. */
+struct FVRSChatTurn
+{
+    FString Role;
+    FString Content;
+};
+
+/**
+ * Client-side conversation memory for the DirectOllama backend.
+ *
+ * Holds past turns in a fixed-capacity ring buffer (oldest dropped first)
+ * additionally trimmed to an approximate token budget, so the prompt cannot
+ * grow without bound. The serialized prefix — system prompt plus the stable
+ * history — is cached as pre-encoded UTF-8 bytes and only rebuilt when a
+ * turn is added or trimmed; per request the component just splices the new
+ * user turn onto the cached bytes instead of rebuilding a JSON DOM.
+ */
+class FVRSecretaryChatHistory
+{
+public:
+    FVRSecretaryChatHistory(int32 InMaxTurns, int32 InTokenBudget);
+
+    /** Append a completed turn, dropping the oldest over capacity/budget. */
+    void AddTurn(const FString& Role, const FString& Content);
+
+    /** Forget the conversation. */
+    void Reset();
+
+    int32 NumTurns() const { return Count; }
+
+    /**
+     * Retarget the token budget without rebuilding the window (the adaptive
+     * quality controller shrinks it on constrained links). Trims immediately
+     * when the new budget is tighter than the current contents.
+     */
+    void SetTokenBudget(int32 InTokenBudget);
+
+    /**
+     * Save or load the turn window as a compact binary blob (the session
+     * handover across level travel). Loading replays the turns through
+     * AddTurn, so the live capacity and token budget apply — a snapshot
+     * taken under larger limits is trimmed, not trusted.
+     */
+    void Serialize(FArchive& Ar);
+
+    /**
+     * UTF-8 bytes of `"messages":[{system},{turn},...` — everything up to,
+     * but not including, the new user turn. No trailing comma or bracket;
+     * the caller splices `,{user}]` plus sampling fields after it.
+     */
+    const TArray<uint8>& GetEncodedPrefixUtf8(const FString& SystemPrompt);
+
+    /** Serialize one {"role":...,"content":...} object (condensed, escaped). */
+    static FString SerializeMessageObject(const FString& Role, const FString& Content);
+
+    /** JSON-escape and quote one string value. */
+    static FString SerializeStringValue(const FString& Value);
+
+private:
+    void TrimToBudget();
+
+    /** Crude but serviceable: ~4 characters per token. */
+    static int32 EstimateTokens(const FString& Content) { return Content.Len() / 4 + 1; }
+
+    int32 MaxTurns;
+    int32 TokenBudget;
+
+    /** Ring storage, preallocated to MaxTurns; Head is the oldest turn. */
+    TArray<FVRSChatTurn> Turns;
+    int32 Head = 0;
+    int32 Count = 0;
+
+    TArray<uint8> EncodedPrefix;
+    FString CachedSystemPrompt;
+    bool bPrefixDirty = true;
+};
@@ -1,13 +1,32 @@
 #include "VRSecretaryComponent.h"
 #include "VRSecretarySettings.h"
+#include "VRSecretaryChatHistory.h"
+#include "VRSecretaryJsonFields.h"
+#include "VRSecretaryRequestTemplate.h"
+#include "VRSecretarySseStream.h"
+#include "VRSecretaryWebSocketTransport.h"
+#include "VRSecretaryResponseCache.h"
+#include "VRSecretaryDiskCache.h"
+#include "VRSecretaryNetworkQuality.h"
+#include "VRSecretaryRequestScheduler.h"
+#include "VRSecretarySessionState.h"
+#include "VRSecretaryStats.h"
+#include "VRSLlamaRunner.h"
 #include "VRSecretaryLog.h"
 
+#include "Async/Async.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Json.h"
 #include "JsonUtilities.h"
+#include "Misc/Base64.h"
 #include "Misc/Guid.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 
 UVRSecretaryComponent::UVRSecretaryComponent()
 {
@@ -17,175 +36,1613 @@ UVRSecretaryComponent::UVRSecretaryComponent()
     LanguageCode = TEXT(""); // Empty = use project default
 }
 
+UVRSecretaryComponent::~UVRSecretaryComponent() = default;
+
 void UVRSecretaryComponent::BeginPlay()
 {
     Super::BeginPlay();
     Settings = GetDefault<UVRSecretarySettings>();
+
+    // A parked session from before level travel takes precedence over a
+    // freshly generated id; the prewarm below re-establishes the transport.
+    if (bPersistSessionAcrossTravel)
+    {
+        TryRestoreSessionState();
+    }
     EnsureSessionId();
 
+    FVRSecretaryResponseCache::Get().SetCapacityBytes(
+        (int64)Settings->ResponseCacheSizeMB * 1024 * 1024);
+    FVRSecretaryDiskCache::Get().Initialize(
+        (int64)Settings->DiskAudioCacheSizeMB * 1024 * 1024);
+
     const FString EffectiveLang = GetEffectiveLanguageCode();
-    UE_LOG(LogVRSecretary, Log, TEXT("VRSecretaryComponent started (Session: %s, Language: %s)"), 
+    UE_LOG(LogVRSecretary, Log, TEXT("VRSecretaryComponent started (Session: %s, Language: %s)"),
            *SessionId, *EffectiveLang);
+
+    // Warm up the gateway connection so the first utterance doesn't pay
+    // DNS + TCP + TLS. Jittered so many components don't hit the gateway at
+    // the same instant on level start.
+    if (Settings->bPrewarmGatewayConnection)
+    {
+        const float Delay = FMath::FRandRange(0.0f, FMath::Max(0.0f, Settings->PrewarmMaxJitterSeconds));
+        if (Delay > 0.0f && GetWorld())
+        {
+            FTimerHandle PrewarmTimer;
+            GetWorld()->GetTimerManager().SetTimer(
+                PrewarmTimer, this, &UVRSecretaryComponent::PrewarmGatewayConnection, Delay, false);
+        }
+        else
+        {
+            PrewarmGatewayConnection();
+        }
+    }
+}
+
+void UVRSecretaryComponent::PrewarmGatewayConnection()
+{
+    const EVRSecretaryBackendMode Mode = GetEffectiveBackendMode();
+
+    if (Mode == EVRSecretaryBackendMode::GatewayWebSocket)
+    {
+        // Prewarm for WebSocket mode means bringing the session socket up.
+        GetOrCreateWsTransport().EnsureConnected();
+        return;
+    }
+
+    if (Mode != EVRSecretaryBackendMode::GatewayOllama &&
+        Mode != EVRSecretaryBackendMode::GatewayWatsonx)
+    {
+        return; // Direct/local backends have no gateway to warm.
+    }
+
+    FString Url = Settings->GatewayUrl;
+    Url.RemoveFromEnd(TEXT("/"));
+    Url += TEXT("/health");
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Url);
+    Request->SetVerb(TEXT("GET"));
+    Request->SetTimeout(Settings->HttpTimeout);
+    Request->OnProcessRequestComplete().BindLambda(
+        [](FHttpRequestPtr, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            // Best effort: the point was establishing the connection, not the
+            // response. Failures will surface properly on the first real send.
+            UE_LOG(LogVRSecretary, Verbose, TEXT("Gateway prewarm %s"),
+                   bWasSuccessful && Response.IsValid() ? TEXT("succeeded") : TEXT("failed"));
+        });
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Prewarming gateway connection (%s)"), *Url);
+    Request->ProcessRequest();
+}
+
+void UVRSecretaryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (bPersistSessionAcrossTravel)
+    {
+        SaveSessionState();
+    }
+
+    CancelPendingRequests();
+
+    // Prefetches survive CancelPendingRequests by design; teardown is where
+    // they stop. Clear the list first so their completion callbacks (which
+    // may fire synchronously from CancelRequest) and any entries still in
+    // the scheduler's prefetch lane find no bookkeeping and drop out.
+    TArray<FPrefetchRequest> Prefetches = MoveTemp(PrefetchRequests);
+    PrefetchRequests.Reset();
+    for (const FPrefetchRequest& Prefetch : Prefetches)
+    {
+        if (Prefetch.bDispatched && Prefetch.Request.IsValid())
+        {
+            Prefetch.Request->CancelRequest();
+        }
+    }
+
+    if (WsTransport.IsValid())
+    {
+        WsTransport->Close();
+        WsTransport.Reset();
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UVRSecretaryComponent::EnsureSessionId()
 {
     if (SessionId.IsEmpty())
     {
-        SessionId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
-        UE_LOG(LogVRSecretary, Verbose, TEXT("Generated new SessionId: %s"), *SessionId);
+        SessionId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens);
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Generated new SessionId: %s"), *SessionId);
+    }
+}
+
+FString UVRSecretaryComponent::GetEffectiveLanguageCode() const
+{
+    // Priority:
+    // 1. Component's LanguageCode (if set)
+    // 2. Project's DefaultLanguageCode (if set)
+    // 3. Fall back to "en"
+
+    if (!LanguageCode.IsEmpty())
+    {
+        return LanguageCode;
+    }
+
+    if (Settings && !Settings->DefaultLanguageCode.IsEmpty())
+    {
+        return Settings->DefaultLanguageCode;
+    }
+
+    return TEXT("en"); // Final fallback
+}
+
+UVRSecretaryRequestScheduler* UVRSecretaryComponent::GetScheduler() const
+{
+    const UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UVRSecretaryRequestScheduler>() : nullptr;
+}
+
+EVRSecretaryNetworkTier UVRSecretaryComponent::GetNetworkTier() const
+{
+    return FVRSecretaryNetworkQuality::Get().GetTier();
+}
+
+float UVRSecretaryComponent::GetEffectiveHttpTimeout() const
+{
+    return bAdaptiveQuality
+        ? FVRSecretaryNetworkQuality::Get().AdaptTimeoutSeconds(Settings->HttpTimeout)
+        : Settings->HttpTimeout;
+}
+
+float UVRSecretaryComponent::GetEffectiveHedgeThresholdSeconds() const
+{
+    return bAdaptiveQuality
+        ? FVRSecretaryNetworkQuality::Get().AdaptHedgeThresholdSeconds(Settings->HedgeThresholdSeconds)
+        : Settings->HedgeThresholdSeconds;
+}
+
+UVRSecretarySessionState* UVRSecretaryComponent::GetSessionState() const
+{
+    const UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UVRSecretarySessionState>() : nullptr;
+}
+
+FString UVRSecretaryComponent::GetEffectivePersistenceKey() const
+{
+    if (!SessionPersistenceKey.IsEmpty())
+    {
+        return SessionPersistenceKey;
+    }
+    const AActor* Owner = GetOwner();
+    return Owner ? Owner->GetName() : FString();
+}
+
+void UVRSecretaryComponent::SaveSessionState()
+{
+    UVRSecretarySessionState* SessionState = GetSessionState();
+    const FString Key = GetEffectivePersistenceKey();
+    if (!bPersistSessionAcrossTravel || !SessionState || Key.IsEmpty() || SessionId.IsEmpty())
+    {
+        return;
+    }
+
+    FVRSecretarySessionSnapshot Snapshot;
+    Snapshot.SessionId = SessionId;
+    if (DirectHistory.IsValid() && DirectHistory->NumTurns() > 0)
+    {
+        FMemoryWriter Writer(Snapshot.HistoryBlob);
+        DirectHistory->Serialize(Writer);
+    }
+    SessionState->Store(Key, MoveTemp(Snapshot));
+}
+
+bool UVRSecretaryComponent::TryRestoreSessionState()
+{
+    UVRSecretarySessionState* SessionState = GetSessionState();
+    const FString Key = GetEffectivePersistenceKey();
+
+    FVRSecretarySessionSnapshot Snapshot;
+    if (!SessionState || Key.IsEmpty() || !SessionState->Restore(Key, Snapshot))
+    {
+        return false;
+    }
+
+    SessionId = Snapshot.SessionId;
+    if (Snapshot.HistoryBlob.Num() > 0)
+    {
+        // Rebuild under the *current* limits: Serialize replays the turns
+        // through AddTurn, so capacity and token budget apply on load.
+        DirectHistory = MakeUnique<FVRSecretaryChatHistory>(
+            Settings->DirectOllamaMaxHistoryTurns,
+            Settings->DirectOllamaHistoryTokenBudget);
+        FMemoryReader Reader(Snapshot.HistoryBlob);
+        DirectHistory->Serialize(Reader);
+    }
+
+    UE_LOG(LogVRSecretary, Verbose,
+           TEXT("Restored parked session \"%s\" (Session: %s, %d history turns)"),
+           *Key, *SessionId, DirectHistory.IsValid() ? DirectHistory->NumTurns() : 0);
+    return true;
+}
+
+UVRSecretaryComponent::FInFlightRequest* UVRSecretaryComponent::FindInFlightByHandle(int32 Handle)
+{
+    return InFlightRequests.FindByPredicate([Handle](const FInFlightRequest& InFlight)
+    {
+        return InFlight.Handle == Handle;
+    });
+}
+
+EVRSecretaryBackendMode UVRSecretaryComponent::GetEffectiveBackendMode() const
+{
+    // Use project-level backend unless this component overrides it
+    if (BackendModeOverride != EVRSecretaryBackendMode::GatewayOllama)
+    {
+        return BackendModeOverride;
+    }
+    return Settings ? Settings->BackendMode : EVRSecretaryBackendMode::GatewayOllama;
+}
+
+int32 UVRSecretaryComponent::SendUserText(const FString& UserText, const FVRSecretaryChatConfig& Config)
+{
+    if (UserText.IsEmpty())
+    {
+        UE_LOG(LogVRSecretary, Warning, TEXT("SendUserText: UserText is empty"));
+        OnError.Broadcast(TEXT("UserText is empty"));
+        return INDEX_NONE;
+    }
+
+    if (!Settings)
+    {
+        UE_LOG(LogVRSecretary, Error, TEXT("VRSecretary settings not found"));
+        OnError.Broadcast(TEXT("VRSecretary settings not found"));
+        return INDEX_NONE;
+    }
+
+    EnsureSessionId();
+
+    // A new utterance supersedes whatever is still in flight (unless the
+    // component opts into parallel requests).
+    if (PendingRequestPolicy == EVRSecretaryPendingRequestPolicy::CancelPrevious &&
+        InFlightRequests.Num() > 0)
+    {
+        UE_LOG(LogVRSecretary, Verbose, TEXT("New utterance supersedes %d in-flight request(s)"),
+               InFlightRequests.Num());
+        CancelPendingRequests();
+    }
+
+    const EVRSecretaryBackendMode Mode = GetEffectiveBackendMode();
+
+    switch (Mode)
+    {
+    case EVRSecretaryBackendMode::GatewayOllama:
+    case EVRSecretaryBackendMode::GatewayWatsonx:
+    case EVRSecretaryBackendMode::GatewayWebSocket:
+        // Repeated phrases resolve instantly from the response cache.
+        if (bEnableResponseCache)
+        {
+            FVRSCachedResponse Cached;
+            const FString CacheKey = FVRSecretaryResponseCache::MakeKey(UserText, GetEffectiveLanguageCode());
+            if (FVRSecretaryResponseCache::Get().Find(CacheKey, Cached))
+            {
+                UE_LOG(LogVRSecretary, Verbose, TEXT("Response cache hit for \"%s\""), *UserText);
+                OnAssistantResponse.Broadcast(Cached.AssistantText, Cached.AudioWavBase64);
+                if (Cached.AudioWavData.Num() > 0)
+                {
+                    OnAssistantAudioReady.Broadcast(Cached.AudioWavData);
+                }
+                return INDEX_NONE;
+            }
+
+            // RAM miss — recurring lines from earlier sessions live on disk.
+            FString DiskText;
+            TArray<uint8> DiskAudio;
+            if (FVRSecretaryDiskCache::Get().Find(CacheKey, DiskText, DiskAudio))
+            {
+                UE_LOG(LogVRSecretary, Verbose, TEXT("Disk audio cache hit for \"%s\""), *UserText);
+
+                // Promote to the RAM cache so the next hit skips the disk.
+                FVRSCachedResponse Promoted;
+                Promoted.AssistantText = DiskText;
+                Promoted.AudioWavData = DiskAudio;
+                FVRSecretaryResponseCache::Get().Add(CacheKey, MoveTemp(Promoted));
+
+                OnAssistantResponse.Broadcast(DiskText, FString());
+                if (DiskAudio.Num() > 0)
+                {
+                    OnAssistantAudioReady.Broadcast(DiskAudio);
+                }
+                return INDEX_NONE;
+            }
+        }
+        return Mode == EVRSecretaryBackendMode::GatewayWebSocket
+            ? SendViaGatewayWebSocket(UserText)
+            : SendViaGateway(UserText);
+
+    case EVRSecretaryBackendMode::DirectOllama:
+        return SendViaDirectOllama(UserText, Config);
+
+    case EVRSecretaryBackendMode::LocalLlamaCpp:
+        return SendViaLocalLlamaCpp(UserText, Config);
+
+    default:
+        UE_LOG(LogVRSecretary, Error, TEXT("Unknown backend mode"));
+        OnError.Broadcast(TEXT("Unknown backend mode"));
+        return INDEX_NONE;
+    }
+}
+
+void UVRSecretaryComponent::CancelPendingRequests()
+{
+    if (InFlightRequests.Num() == 0)
+    {
+        return;
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Cancelling %d in-flight request(s)"), InFlightRequests.Num());
+
+    // A pending retry backoff belongs to the superseded utterance too.
+    if (GetWorld())
+    {
+        GetWorld()->GetTimerManager().ClearTimer(GatewayRetryTimer);
+    }
+
+    if (UVRSecretaryRequestScheduler* Scheduler = GetScheduler())
+    {
+        Scheduler->CancelQueued(this);
+    }
+
+    // Move dispatched requests to the cancelled list first so the completion
+    // callbacks (which may fire synchronously from CancelRequest) are
+    // swallowed. Undispatched (still queued) requests never reached the wire
+    // and will never call back; dropping them is enough.
+    TArray<FInFlightRequest> ToCancel = MoveTemp(InFlightRequests);
+    InFlightRequests.Reset();
+    for (const FInFlightRequest& InFlight : ToCancel)
+    {
+        if (InFlight.bDispatched)
+        {
+            CancelledRequests.Add(InFlight.Request);
+        }
+    }
+
+    ActiveSseStream.Reset();
+
+    for (const FInFlightRequest& InFlight : ToCancel)
+    {
+        if (InFlight.bDispatched && InFlight.Request.IsValid())
+        {
+            InFlight.Request->CancelRequest();
+        }
+    }
+}
+
+bool UVRSecretaryComponent::PrefetchResponse(const FString& UserText, const FVRSecretaryChatConfig& Config)
+{
+    if (UserText.IsEmpty() || !Settings)
+    {
+        return false;
+    }
+
+    const EVRSecretaryBackendMode Mode = GetEffectiveBackendMode();
+    if (Mode != EVRSecretaryBackendMode::GatewayOllama &&
+        Mode != EVRSecretaryBackendMode::GatewayWatsonx &&
+        Mode != EVRSecretaryBackendMode::GatewayWebSocket)
+    {
+        UE_LOG(LogVRSecretary, Verbose, TEXT("PrefetchResponse: no gateway backend to prefetch from"));
+        return false;
+    }
+
+    if (!bEnableResponseCache)
+    {
+        UE_LOG(LogVRSecretary, Warning,
+               TEXT("PrefetchResponse: response cache disabled; nowhere to park the reply"));
+        return false;
+    }
+
+    EnsureSessionId();
+
+    const FString EffectiveLang = GetEffectiveLanguageCode();
+    const FString CacheKey = FVRSecretaryResponseCache::MakeKey(UserText, EffectiveLang);
+
+    FVRSCachedResponse Existing;
+    if (FVRSecretaryResponseCache::Get().Find(CacheKey, Existing))
+    {
+        return false; // Already warm.
+    }
+
+    // A line cached on disk from an earlier session just needs promoting, so
+    // the trigger-time SendUserText skips the file read too.
+    FString DiskText;
+    TArray<uint8> DiskAudio;
+    if (FVRSecretaryDiskCache::Get().Find(CacheKey, DiskText, DiskAudio))
+    {
+        FVRSCachedResponse Promoted;
+        Promoted.AssistantText = DiskText;
+        Promoted.AudioWavData = MoveTemp(DiskAudio);
+        FVRSecretaryResponseCache::Get().Add(CacheKey, MoveTemp(Promoted));
+        UE_LOG(LogVRSecretary, Verbose, TEXT("PrefetchResponse: promoted disk-cached reply for \"%s\""),
+               *UserText);
+        return true;
+    }
+
+    FString Body;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_RequestSerialize);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, RequestSerialize);
+
+        // Prefetch always asks for one plain JSON reply — the cache stores
+        // whole replies — so streaming and pipelining stay off the key.
+        FVRSecretaryRequestTemplateKey Key;
+        Key.SessionId = SessionId;
+        Key.Language = EffectiveLang;
+        Key.bStream = false;
+        Key.bPipelineTts = false;
+        Key.bBinaryAudioTransport = bUseBinaryAudioTransport;
+        Key.bAcceptOpus = bAcceptOpusAudio ||
+            (bAdaptiveQuality && FVRSecretaryNetworkQuality::Get().ShouldPreferCompressedAudio());
+
+        if (!PrefetchRequestTemplate.IsValid())
+        {
+            PrefetchRequestTemplate = MakeUnique<FVRSecretaryRequestTemplate>();
+        }
+        PrefetchRequestTemplate->EnsureCompiled(Key);
+        Body = PrefetchRequestTemplate->BuildBody(UserText);
+    }
+
+    const FString Url = GetGatewayBaseUrl(0) + TEXT("/api/vr_chat");
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Url);
+    Request->SetVerb(TEXT("POST"));
+    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    Request->SetContentAsString(Body);
+    Request->SetTimeout(GetEffectiveHttpTimeout());
+
+    TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, CacheKey](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->HandlePrefetchResponse(Req, Response, bWasSuccessful, CacheKey);
+            }
+        });
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetching gateway reply for \"%s\""), *UserText);
+    TrackAndDispatchPrefetch(Request);
+    return true;
+}
+
+UVRSecretaryComponent::FPrefetchRequest* UVRSecretaryComponent::FindPrefetch(const FHttpRequestPtr& Request)
+{
+    return PrefetchRequests.FindByPredicate([&Request](const FPrefetchRequest& Prefetch)
+    {
+        return Prefetch.Request == Request;
+    });
+}
+
+void UVRSecretaryComponent::TrackAndDispatchPrefetch(const FHttpRequestPtr& Request)
+{
+    FPrefetchRequest Prefetch;
+    Prefetch.Request = Request;
+
+    UVRSecretaryRequestScheduler* Scheduler = GetScheduler();
+    if (Scheduler && Settings->MaxConcurrentGatewayRequests > 0)
+    {
+        Prefetch.bDispatched = false;
+        PrefetchRequests.Add(Prefetch);
+
+        TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+        Scheduler->EnqueuePrefetch(this, [WeakThis, Request]() -> bool
+        {
+            if (!WeakThis.IsValid())
+            {
+                return false;
+            }
+            FPrefetchRequest* Queued = WeakThis->FindPrefetch(Request);
+            if (!Queued)
+            {
+                return false; // Torn down while queued.
+            }
+            Queued->bDispatched = true;
+            Request->ProcessRequest();
+            return true;
+        });
+    }
+    else
+    {
+        PrefetchRequests.Add(Prefetch);
+        Request->ProcessRequest();
+    }
+}
+
+void UVRSecretaryComponent::HandlePrefetchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                                                   bool bWasSuccessful, const FString& CacheKey)
+{
+    if (UVRSecretaryRequestScheduler* Scheduler = GetScheduler())
+    {
+        Scheduler->NotifyRequestFinished();
+    }
+
+    const int32 Index = PrefetchRequests.IndexOfByPredicate([&Request](const FPrefetchRequest& Prefetch)
+    {
+        return Prefetch.Request == Request;
+    });
+    if (Index == INDEX_NONE)
+    {
+        return; // Cancelled at teardown; drop silently.
+    }
+    PrefetchRequests.RemoveAt(Index, 1, /*bAllowShrinking=*/false);
+
+    if (!bWasSuccessful || !Response.IsValid() ||
+        !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    {
+        // No OnError and no retries: a failed prefetch just means the real
+        // send pays full price.
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetch failed (HTTP %d)"),
+               Response.IsValid() ? Response->GetResponseCode() : 0);
+        return;
+    }
+
+    FParsedGatewayReply Parsed;
+    ParseGatewayReplyBody(Response->GetContent(), Parsed);
+    if (!Parsed.bValid)
+    {
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetch reply failed to parse; dropped"));
+        return;
+    }
+
+    // Park the reply exactly as the interactive handlers would, so the
+    // trigger-time cache hit replays it indistinguishably.
+    FVRSCachedResponse Cached;
+    Cached.AssistantText = Parsed.AssistantText;
+    if (Parsed.AudioWavData.Num() > 0)
+    {
+        FVRSecretaryDiskCache::Get().Add(CacheKey, Parsed.AssistantText, Parsed.AudioWavData);
+        Cached.AudioWavData = MoveTemp(Parsed.AudioWavData);
+    }
+    else
+    {
+        PersistToDiskCache(CacheKey, Parsed.AssistantText, Parsed.AudioBase64);
+        Cached.AudioWavBase64 = Parsed.AudioBase64;
+    }
+    FVRSecretaryResponseCache::Get().Add(CacheKey, MoveTemp(Cached));
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetched reply cached (%d chars)"), Parsed.AssistantText.Len());
+
+    // Binary transport: the reply's audio rides a short-lived URL; download
+    // it quietly through the same prefetch lane so the cached entry has
+    // audio before the player triggers the line.
+    if (!Parsed.AudioUrl.IsEmpty())
+    {
+        FString ResolvedUrl = Parsed.AudioUrl;
+        if (ResolvedUrl.StartsWith(TEXT("/")))
+        {
+            ResolvedUrl = GetGatewayBaseUrl(0) + ResolvedUrl;
+        }
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> AudioRequest = FHttpModule::Get().CreateRequest();
+        AudioRequest->SetURL(ResolvedUrl);
+        AudioRequest->SetVerb(TEXT("GET"));
+        AudioRequest->SetTimeout(GetEffectiveHttpTimeout());
+
+        TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+        AudioRequest->OnProcessRequestComplete().BindLambda(
+            [WeakThis, CacheKey](FHttpRequestPtr Req, FHttpResponsePtr AudioResponse, bool bOk)
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->HandlePrefetchAudioResponse(Req, AudioResponse, bOk, CacheKey);
+                }
+            });
+
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetching binary audio from %s"), *ResolvedUrl);
+        TrackAndDispatchPrefetch(AudioRequest);
+    }
+}
+
+void UVRSecretaryComponent::HandlePrefetchAudioResponse(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                                                        bool bWasSuccessful, const FString& CacheKey)
+{
+    if (UVRSecretaryRequestScheduler* Scheduler = GetScheduler())
+    {
+        Scheduler->NotifyRequestFinished();
+    }
+
+    const int32 Index = PrefetchRequests.IndexOfByPredicate([&Request](const FPrefetchRequest& Prefetch)
+    {
+        return Prefetch.Request == Request;
+    });
+    if (Index == INDEX_NONE)
+    {
+        return; // Cancelled at teardown; drop silently.
+    }
+    PrefetchRequests.RemoveAt(Index, 1, /*bAllowShrinking=*/false);
+
+    if (!bWasSuccessful || !Response.IsValid() ||
+        !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    {
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetch audio download failed"));
+        return;
+    }
+
+    const TArray<uint8>& AudioData = Response->GetContent();
+    FVRSecretaryResponseCache::Get().SetAudioData(CacheKey, AudioData);
+
+    FVRSCachedResponse Cached;
+    if (FVRSecretaryDiskCache::Get().IsEnabled() &&
+        FVRSecretaryResponseCache::Get().Find(CacheKey, Cached))
+    {
+        FVRSecretaryDiskCache::Get().Add(CacheKey, Cached.AssistantText, AudioData);
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Prefetched binary audio cached (%d bytes)"), AudioData.Num());
+}
+
+int32 UVRSecretaryComponent::TrackRequest(const FHttpRequestPtr& Request, const FString& CacheKey,
+                                          double UtteranceStartSeconds)
+{
+    FInFlightRequest InFlight;
+    InFlight.Handle = NextRequestHandle++;
+    InFlight.Request = Request;
+    InFlight.CacheKey = CacheKey;
+    InFlight.StartTimeSeconds = FPlatformTime::Seconds();
+    InFlight.UtteranceStartSeconds = UtteranceStartSeconds >= 0.0
+        ? UtteranceStartSeconds
+        : InFlight.StartTimeSeconds;
+    InFlightRequests.Add(InFlight);
+    return InFlight.Handle;
+}
+
+bool UVRSecretaryComponent::FinishRequest(const FHttpRequestPtr& Request, FInFlightRequest* OutInFlight)
+{
+    const int32 CancelledIndex = CancelledRequests.IndexOfByKey(Request);
+    if (CancelledIndex != INDEX_NONE)
+    {
+        CancelledRequests.RemoveAt(CancelledIndex);
+        return true;
+    }
+
+    for (int32 Index = 0; Index < InFlightRequests.Num(); ++Index)
+    {
+        if (InFlightRequests[Index].Request == Request)
+        {
+            if (OutInFlight)
+            {
+                *OutInFlight = MoveTemp(InFlightRequests[Index]);
+            }
+            InFlightRequests.RemoveAt(Index, 1, /*bAllowShrinking=*/false);
+            break;
+        }
+    }
+    return false;
+}
+
+TArray<FString> UVRSecretaryComponent::GetGatewayUrls() const
+{
+    TArray<FString> Urls;
+    Urls.Add(Settings->GatewayUrl);
+    for (const FString& Extra : Settings->AdditionalGatewayUrls)
+    {
+        if (!Extra.TrimStartAndEnd().IsEmpty())
+        {
+            Urls.Add(Extra);
+        }
+    }
+    return Urls;
+}
+
+FString UVRSecretaryComponent::GetGatewayBaseUrl(int32 UrlIndex) const
+{
+    const TArray<FString> Urls = GetGatewayUrls();
+    FString Base = Urls[UrlIndex % Urls.Num()];
+    Base.RemoveFromEnd(TEXT("/"));
+    return Base;
+}
+
+int32 UVRSecretaryComponent::SendViaGateway(const FString& UserText)
+{
+    const FString EffectiveLang = GetEffectiveLanguageCode();
+
+    // The adaptive controller may upgrade the transport for the measured
+    // link: compressed audio when bandwidth is constrained, streamed replies
+    // when the link is poor (partial text lands while the rest trickles in).
+    // It only ever turns options on — explicit settings are respected.
+    bool bEffectiveStream = bStreamResponses;
+    bool bEffectiveOpus = bAcceptOpusAudio;
+    if (bAdaptiveQuality)
+    {
+        const FVRSecretaryNetworkQuality& Quality = FVRSecretaryNetworkQuality::Get();
+        bEffectiveStream = bEffectiveStream || Quality.ShouldPreferStreaming();
+        bEffectiveOpus = bEffectiveOpus || Quality.ShouldPreferCompressedAudio();
+    }
+
+    FString Body;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_RequestSerialize);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, RequestSerialize);
+
+        // Splice the body from the precompiled template instead of building
+        // a JSON DOM per send; the template recompiles only when the session
+        // or the payload-shaping settings change.
+        FVRSecretaryRequestTemplateKey Key;
+        Key.SessionId = SessionId;
+        Key.Language = EffectiveLang;
+        Key.bStream = bEffectiveStream;
+        Key.bPipelineTts = bEffectiveStream && bPipelineTtsAudio;
+        Key.bBinaryAudioTransport = bUseBinaryAudioTransport;
+        Key.bAcceptOpus = bEffectiveOpus;
+
+        if (!GatewayRequestTemplate.IsValid())
+        {
+            GatewayRequestTemplate = MakeUnique<FVRSecretaryRequestTemplate>();
+        }
+        GatewayRequestTemplate->EnsureCompiled(Key);
+        Body = GatewayRequestTemplate->BuildBody(UserText);
+    }
+
+    // Pipelined replies deliver audio in segments, never as one cacheable
+    // unit, so they are not entered into the response cache.
+    const FString CacheKey = (bEnableResponseCache && !(bEffectiveStream && bPipelineTtsAudio))
+        ? FVRSecretaryResponseCache::MakeKey(UserText, EffectiveLang)
+        : FString();
+
+    const double UtteranceStart = FPlatformTime::Seconds();
+
+    if (bEffectiveStream)
+    {
+        return DispatchStreamedGatewayRequest(Body, CacheKey, UtteranceStart);
+    }
+
+    return DispatchGatewayAttempt(Body, CacheKey, UtteranceStart,
+                                  /*AttemptIndex=*/0, /*UrlIndex=*/0, /*HedgeGroup=*/INDEX_NONE);
+}
+
+int32 UVRSecretaryComponent::DispatchStreamedGatewayRequest(const FString& Body, const FString& CacheKey,
+                                                            double UtteranceStartSeconds)
+{
+    const double UtteranceStart = UtteranceStartSeconds;
+    const FString Url = GetGatewayBaseUrl(0) + TEXT("/api/vr_chat");
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Url);
+    Request->SetVerb(TEXT("POST"));
+    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    Request->SetHeader(TEXT("Accept"), TEXT("text/event-stream"));
+    Request->SetContentAsString(Body);
+
+    // Parse SSE frames as bytes arrive instead of waiting for the full
+    // body. The reader's callbacks run on the HTTP thread, so marshal the
+    // broadcasts back to the game thread.
+    ActiveSseStream = MakeShared<FVRSecretarySseStream, ESPMode::ThreadSafe>();
+
+    TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+
+    ActiveSseStream->OnTextDelta =
+        [WeakThis](const FString& Delta, const FString& Accumulated)
+        {
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Delta, Accumulated]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->OnAssistantTextDelta.Broadcast(Delta, Accumulated);
+                }
+            });
+        };
+
+    ActiveSseStream->OnAudioSegment =
+        [WeakThis, UtteranceStart](int32 SegmentIndex, bool bLast, const FString& AudioBase64)
+        {
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, UtteranceStart, SegmentIndex, bLast, AudioBase64]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    if (SegmentIndex == 0 && !AudioBase64.IsEmpty())
+                    {
+                        const float AudioMs = (float)((FPlatformTime::Seconds() - UtteranceStart) * 1000.0);
+                        SET_FLOAT_STAT(STAT_VRSecretary_TimeToFirstAudioMs, AudioMs);
+                        CSV_CUSTOM_STAT(VRSecretary, TimeToFirstAudioMs, AudioMs, ECsvCustomStatOp::Set);
+                    }
+                    WeakThis->OnAssistantAudioSegment.Broadcast(SegmentIndex, bLast, AudioBase64);
+                }
+            });
+        };
+
+    ActiveSseStream->OnFinalFrame =
+        [WeakThis, CacheKey, UtteranceStart](const FString& AssistantText, const FString& AudioBase64, const FString& AudioUrl)
+        {
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, CacheKey, UtteranceStart, AssistantText, AudioBase64, AudioUrl]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    UE_LOG(LogVRSecretary, Verbose,
+                           TEXT("Streamed gateway response complete (%d chars)"),
+                           AssistantText.Len());
+                    if (!CacheKey.IsEmpty())
+                    {
+                        WeakThis->PersistToDiskCache(CacheKey, AssistantText, AudioBase64);
+
+                        FVRSCachedResponse Cached;
+                        Cached.AssistantText = AssistantText;
+                        Cached.AudioWavBase64 = AudioBase64;
+                        FVRSecretaryResponseCache::Get().Add(CacheKey, MoveTemp(Cached));
+                    }
+                    if (!AudioBase64.IsEmpty())
+                    {
+                        const float AudioMs = (float)((FPlatformTime::Seconds() - UtteranceStart) * 1000.0);
+                        SET_FLOAT_STAT(STAT_VRSecretary_TimeToFirstAudioMs, AudioMs);
+                        CSV_CUSTOM_STAT(VRSecretary, TimeToFirstAudioMs, AudioMs, ECsvCustomStatOp::Set);
+                    }
+                    WeakThis->OnAssistantResponse.Broadcast(AssistantText, AudioBase64);
+                    if (!AudioUrl.IsEmpty())
+                    {
+                        WeakThis->FetchBinaryAudio(AudioUrl, CacheKey, UtteranceStart);
+                    }
+                }
+            });
+        };
+
+    Request->SetResponseBodyReceiveStream(ActiveSseStream.ToSharedRef());
+
+    Request->OnProcessRequestComplete().BindUObject(
+        this,
+        &UVRSecretaryComponent::HandleGatewayResponse
+    );
+    Request->SetTimeout(GetEffectiveHttpTimeout());
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Sending streamed Gateway request to %s"), *Url);
+    const int32 Handle = TrackRequest(Request, CacheKey, UtteranceStart);
+
+    UVRSecretaryRequestScheduler* Scheduler = GetScheduler();
+    if (Scheduler && Settings->MaxConcurrentGatewayRequests > 0)
+    {
+        if (FInFlightRequest* InFlight = FindInFlightByHandle(Handle))
+        {
+            InFlight->bDispatched = false;
+        }
+
+        Scheduler->Enqueue(this, RequestPriority, [WeakThis, Handle, Request]() -> bool
+        {
+            if (!WeakThis.IsValid())
+            {
+                return false;
+            }
+            FInFlightRequest* InFlight = WeakThis->FindInFlightByHandle(Handle);
+            if (!InFlight)
+            {
+                return false; // Superseded while queued.
+            }
+            InFlight->bDispatched = true;
+            // Re-stamp so the network stat measures wire time, not queue time.
+            InFlight->StartTimeSeconds = FPlatformTime::Seconds();
+            Request->ProcessRequest();
+            return true;
+        });
+    }
+    else
+    {
+        Request->ProcessRequest();
+    }
+    return Handle;
+}
+
+int32 UVRSecretaryComponent::DispatchGatewayAttempt(const FString& Body, const FString& CacheKey,
+                                                    double UtteranceStartSeconds, int32 AttemptIndex,
+                                                    int32 UrlIndex, int32 HedgeGroup)
+{
+    const FString Url = GetGatewayBaseUrl(UrlIndex) + TEXT("/api/vr_chat");
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Url);
+    Request->SetVerb(TEXT("POST"));
+    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    Request->SetContentAsString(Body);
+    if (bProcessResponsesOffGameThread)
+    {
+        // Completion lands on the HTTP thread, where the static parse helper
+        // does all the byte churn; only the reduced result crosses back to
+        // the game thread for bookkeeping and broadcast.
+        Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+
+        TWeakObjectPtr<UVRSecretaryComponent> WeakParser(this);
+        Request->OnProcessRequestComplete().BindLambda(
+            [WeakParser](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bWasSuccessful)
+            {
+                TSharedPtr<FParsedGatewayReply> Parsed;
+                if (bWasSuccessful && Response.IsValid() &&
+                    EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+                {
+                    Parsed = MakeShared<FParsedGatewayReply>();
+                    ParseGatewayReplyBody(Response->GetContent(), *Parsed);
+                }
+
+                AsyncTask(ENamedThreads::GameThread,
+                          [WeakParser, Req, Response, bWasSuccessful, Parsed]()
+                {
+                    if (WeakParser.IsValid())
+                    {
+                        WeakParser->FinishGatewayResponse(Req, Response, bWasSuccessful, Parsed.Get());
+                    }
+                });
+            });
+    }
+    else
+    {
+        Request->OnProcessRequestComplete().BindUObject(
+            this,
+            &UVRSecretaryComponent::HandleGatewayResponse
+        );
+    }
+    Request->SetTimeout(GetEffectiveHttpTimeout());
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Sending Gateway request to %s (attempt %d)"),
+           *Url, AttemptIndex + 1);
+    const int32 Handle = TrackRequest(Request, CacheKey, UtteranceStartSeconds);
+    if (FInFlightRequest* InFlight = FindInFlightByHandle(Handle))
+    {
+        InFlight->RetryBody = Body;
+        InFlight->AttemptIndex = AttemptIndex;
+        InFlight->UrlIndex = UrlIndex;
+        InFlight->HedgeGroup = HedgeGroup;
+    }
+
+    TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+
+    UVRSecretaryRequestScheduler* Scheduler = GetScheduler();
+    if (Scheduler && Settings->MaxConcurrentGatewayRequests > 0)
+    {
+        if (FInFlightRequest* InFlight = FindInFlightByHandle(Handle))
+        {
+            InFlight->bDispatched = false;
+        }
+
+        Scheduler->Enqueue(this, RequestPriority, [WeakThis, Handle, Request]() -> bool
+        {
+            if (!WeakThis.IsValid())
+            {
+                return false;
+            }
+            FInFlightRequest* InFlight = WeakThis->FindInFlightByHandle(Handle);
+            if (!InFlight)
+            {
+                return false; // Superseded while queued.
+            }
+            InFlight->bDispatched = true;
+            // Re-stamp so the network stat measures wire time, not queue time.
+            InFlight->StartTimeSeconds = FPlatformTime::Seconds();
+            Request->ProcessRequest();
+            return true;
+        });
+    }
+    else
+    {
+        Request->ProcessRequest();
+    }
+
+    // Tail-latency hedge: if this attempt hasn't completed within the
+    // threshold, race a duplicate against the next replica. Whichever reply
+    // lands first wins; the loser is cancelled silently.
+    if (HedgeGroup == INDEX_NONE && AttemptIndex == 0 &&
+        Settings->bHedgeGatewayRequests && GetGatewayUrls().Num() > 1 && GetWorld())
+    {
+        if (FInFlightRequest* InFlight = FindInFlightByHandle(Handle))
+        {
+            InFlight->HedgeGroup = Handle;
+        }
+
+        FTimerHandle HedgeTimer;
+        GetWorld()->GetTimerManager().SetTimer(
+            HedgeTimer,
+            FTimerDelegate::CreateLambda(
+                [WeakThis, Handle, Body, CacheKey, UtteranceStartSeconds, UrlIndex]()
+                {
+                    if (!WeakThis.IsValid() || !WeakThis->FindInFlightByHandle(Handle))
+                    {
+                        return; // Already answered (or cancelled); nothing to hedge.
+                    }
+                    UE_LOG(LogVRSecretary, Verbose, TEXT("Hedging slow gateway request %d"), Handle);
+                    WeakThis->DispatchGatewayAttempt(Body, CacheKey, UtteranceStartSeconds,
+                                                     /*AttemptIndex=*/0, UrlIndex + 1,
+                                                     /*HedgeGroup=*/Handle);
+                }),
+            FMath::Max(0.05f, GetEffectiveHedgeThresholdSeconds()), false);
+    }
+
+    return Handle;
+}
+
+void UVRSecretaryComponent::RetryGatewayAttempt(const FInFlightRequest& Failed)
+{
+    const int32 NextAttempt = Failed.AttemptIndex + 1;
+    const float Delay = Settings->GatewayRetryBackoffSeconds * (float)(1 << Failed.AttemptIndex);
+    UE_LOG(LogVRSecretary, Warning, TEXT("Gateway request failed; retry %d/%d in %.2fs"),
+           NextAttempt, Settings->MaxGatewayRetries, Delay);
+
+    TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+    const FString Body = Failed.RetryBody;
+    const FString CacheKey = Failed.CacheKey;
+    const double UtteranceStart = Failed.UtteranceStartSeconds;
+    const int32 NextUrlIndex = Failed.UrlIndex + 1; // Rotate replicas.
+
+    auto Dispatch = [WeakThis, Body, CacheKey, UtteranceStart, NextAttempt, NextUrlIndex]()
+    {
+        if (WeakThis.IsValid())
+        {
+            WeakThis->DispatchGatewayAttempt(Body, CacheKey, UtteranceStart, NextAttempt,
+                                             NextUrlIndex, /*HedgeGroup=*/INDEX_NONE);
+        }
+    };
+
+    if (Delay > 0.0f && GetWorld())
+    {
+        // One retry backoff per component at a time; CancelPendingRequests
+        // clears it so a superseded utterance can't resend itself.
+        GetWorld()->GetTimerManager().SetTimer(
+            GatewayRetryTimer, FTimerDelegate::CreateLambda(Dispatch), Delay, false);
+    }
+    else
+    {
+        Dispatch();
+    }
+}
+
+bool UVRSecretaryComponent::HasInFlightInGroup(int32 HedgeGroup) const
+{
+    if (HedgeGroup == INDEX_NONE)
+    {
+        return false;
+    }
+    return InFlightRequests.ContainsByPredicate([HedgeGroup](const FInFlightRequest& InFlight)
+    {
+        return InFlight.HedgeGroup == HedgeGroup;
+    });
+}
+
+void UVRSecretaryComponent::CancelHedgeSiblings(int32 HedgeGroup)
+{
+    if (HedgeGroup == INDEX_NONE)
+    {
+        return;
+    }
+
+    // The winner was already removed by FinishRequest, so everything left in
+    // the group is a losing leg. Dispatched losers go through
+    // CancelledRequests so their completions are swallowed; queued ones just
+    // vanish (the scheduler's dispatch lambda finds no entry and declines
+    // the slot).
+    for (int32 Index = InFlightRequests.Num() - 1; Index >= 0; --Index)
+    {
+        if (InFlightRequests[Index].HedgeGroup != HedgeGroup)
+        {
+            continue;
+        }
+        FInFlightRequest Loser = MoveTemp(InFlightRequests[Index]);
+        InFlightRequests.RemoveAt(Index, 1, /*bAllowShrinking=*/false);
+        if (Loser.bDispatched)
+        {
+            CancelledRequests.Add(Loser.Request);
+            if (Loser.Request.IsValid())
+            {
+                Loser.Request->CancelRequest();
+            }
+        }
     }
 }
 
-FString UVRSecretaryComponent::GetEffectiveLanguageCode() const
+void UVRSecretaryComponent::HandleGatewayResponse(
+    FHttpRequestPtr Request,
+    FHttpResponsePtr Response,
+    bool bWasSuccessful)
 {
-    // Priority:
-    // 1. Component's LanguageCode (if set)
-    // 2. Project's DefaultLanguageCode (if set)
-    // 3. Fall back to "en"
+    FinishGatewayResponse(Request, Response, bWasSuccessful, /*PreParsed=*/nullptr);
+}
 
-    if (!LanguageCode.IsEmpty())
+void UVRSecretaryComponent::FinishGatewayResponse(
+    FHttpRequestPtr Request,
+    FHttpResponsePtr Response,
+    bool bWasSuccessful,
+    FParsedGatewayReply* PreParsed)
+{
+    // Chat requests occupy a scheduler slot from dispatch to completion,
+    // including cancelled ones (their callbacks still land here).
+    if (UVRSecretaryRequestScheduler* Scheduler = GetScheduler())
     {
-        return LanguageCode;
+        Scheduler->NotifyRequestFinished();
     }
 
-    if (Settings && !Settings->DefaultLanguageCode.IsEmpty())
+    // Streamed requests are normally finalized by the SSE reader's "done"
+    // frame; here we only clean up and cover the non-SSE fallback.
+    TSharedPtr<FVRSecretarySseStream, ESPMode::ThreadSafe> SseStream = ActiveSseStream;
+    ActiveSseStream.Reset();
+
+    FInFlightRequest InFlight;
+    if (FinishRequest(Request, &InFlight))
     {
-        return Settings->DefaultLanguageCode;
+        return; // Superseded/cancelled; swallow silently.
     }
+    const FString& CacheKey = InFlight.CacheKey;
 
-    return TEXT("en"); // Final fallback
-}
+    const float NetworkMs = (float)((FPlatformTime::Seconds() - InFlight.StartTimeSeconds) * 1000.0);
+    SET_FLOAT_STAT(STAT_VRSecretary_NetworkTimeMs, NetworkMs);
+    CSV_CUSTOM_STAT(VRSecretary, NetworkTimeMs, NetworkMs, ECsvCustomStatOp::Set);
 
-void UVRSecretaryComponent::SendUserText(const FString& UserText, const FVRSecretaryChatConfig& Config)
-{
-    if (UserText.IsEmpty())
+    if (SseStream.IsValid() && SseStream->ReceivedFinalFrame())
     {
-        UE_LOG(LogVRSecretary, Warning, TEXT("SendUserText: UserText is empty"));
-        OnError.Broadcast(TEXT("UserText is empty"));
+        // OnAssistantResponse was already broadcast from the final frame.
+        // Payload 0: a streamed body trickled in, so bytes/elapsed would
+        // measure the stream pacing, not the pipe.
+        FVRSecretaryNetworkQuality::Get().RecordSuccess(NetworkMs, 0);
         return;
     }
 
-    if (!Settings)
+    if (!bWasSuccessful || !Response.IsValid() ||
+        !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
     {
-        UE_LOG(LogVRSecretary, Error, TEXT("VRSecretary settings not found"));
-        OnError.Broadcast(TEXT("VRSecretary settings not found"));
+        FVRSecretaryNetworkQuality::Get().RecordFailure();
+
+        // A hedged sibling still racing makes this leg's outcome
+        // provisional: defer to whichever sibling reply lands.
+        if (InFlight.HedgeGroup != INDEX_NONE && HasInFlightInGroup(InFlight.HedgeGroup))
+        {
+            UE_LOG(LogVRSecretary, Verbose,
+                   TEXT("Hedged gateway attempt failed; sibling still in flight"));
+            return;
+        }
+
+        // Transport errors and 5xx are worth retrying against the next
+        // replica; 4xx means the request itself is bad.
+        const int32 Code = Response.IsValid() ? Response->GetResponseCode() : 0;
+        const bool bRetryable = !Response.IsValid() || Code >= 500;
+        if (bRetryable && !InFlight.RetryBody.IsEmpty() &&
+            InFlight.AttemptIndex < Settings->MaxGatewayRetries)
+        {
+            RetryGatewayAttempt(InFlight);
+            return;
+        }
+
+        const FString Error = Response.IsValid()
+            ? FString::Printf(TEXT("Gateway HTTP %d: %s"), Code, *Response->GetContentAsString())
+            : FString(TEXT("Gateway request failed"));
+        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
+        OnError.Broadcast(Error);
         return;
     }
 
-    EnsureSessionId();
+    FVRSecretaryNetworkQuality::Get().RecordSuccess(NetworkMs, Response->GetContent().Num());
 
-    // Use project-level backend unless this component overrides it
-    EVRSecretaryBackendMode Mode = Settings->BackendMode;
-    if (BackendModeOverride != EVRSecretaryBackendMode::GatewayOllama)
+    // This leg won; abort any hedged sibling still racing it.
+    CancelHedgeSiblings(InFlight.HedgeGroup);
+
+    // When streaming was requested but the gateway answered with a plain JSON
+    // body, the body went into the SSE reader untouched; recover it from
+    // there. Otherwise use the HTTP-thread parse when it already happened,
+    // or do the extraction here.
+    FParsedGatewayReply Parsed;
+    if (PreParsed)
+    {
+        Parsed = MoveTemp(*PreParsed);
+    }
+    else if (SseStream.IsValid())
     {
-        Mode = BackendModeOverride;
+        ParseGatewayReplyString(SseStream->GetUnconsumedBodyAsString(), Parsed);
+    }
+    else
+    {
+        ParseGatewayReplyBody(Response->GetContent(), Parsed);
     }
 
-    switch (Mode)
+    if (!Parsed.bValid)
     {
-    case EVRSecretaryBackendMode::GatewayOllama:
-    case EVRSecretaryBackendMode::GatewayWatsonx:
-        SendViaGateway(UserText);
-        break;
+        const FString Error = TEXT("Failed to parse gateway JSON response");
+        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
+        OnError.Broadcast(Error);
+        return;
+    }
 
-    case EVRSecretaryBackendMode::DirectOllama:
-        SendViaDirectOllama(UserText, Config);
-        break;
+    BroadcastGatewayReply(MoveTemp(Parsed), CacheKey, InFlight.UtteranceStartSeconds, InFlight.UrlIndex);
+}
 
-    case EVRSecretaryBackendMode::LocalLlamaCpp:
-        SendViaLocalLlamaCpp(UserText, Config);
-        break;
+void UVRSecretaryComponent::ParseGatewayReplyBody(const TArray<uint8>& Body, FParsedGatewayReply& OutParsed)
+{
+    // Big replies take the targeted-extraction fast path: scan the raw UTF-8
+    // body for the fields we need instead of converting megabytes to TCHAR
+    // and building a DOM around one giant base64 string.
+    if (Body.Num() >= FastParseThresholdBytes)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_JsonParse);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, JsonParse);
 
-    default:
-        UE_LOG(LogVRSecretary, Error, TEXT("Unknown backend mode"));
-        OnError.Broadcast(TEXT("Unknown backend mode"));
-        break;
+        VRSecretaryJson::FStringFieldView TextView;
+        VRSecretaryJson::FStringFieldView AudioView;
+        VRSecretaryJson::FStringFieldView UrlView;
+
+        if (VRSecretaryJson::FindStringField(Body.GetData(), Body.Num(), "assistant_text", TextView))
+        {
+            OutParsed.AssistantText = VRSecretaryJson::ToString(Body.GetData(), TextView);
+
+            // The base64 audio is decoded straight out of the body view — no
+            // intermediate FString copy of the payload.
+            if (VRSecretaryJson::FindStringField(Body.GetData(), Body.Num(), "audio_wav_base64", AudioView) &&
+                AudioView.Length > 0 && !AudioView.bHasEscapes && AudioView.Length % 4 == 0)
+            {
+                const ANSICHAR* Base64 = (const ANSICHAR*)Body.GetData() + AudioView.Offset;
+                const uint32 DecodedSize = FBase64::GetDecodedDataSize(Base64, AudioView.Length);
+                OutParsed.AudioWavData.SetNumUninitialized(DecodedSize);
+                if (!FBase64::Decode(Base64, AudioView.Length, OutParsed.AudioWavData.GetData()))
+                {
+                    OutParsed.AudioWavData.Reset();
+                }
+            }
+
+            if (VRSecretaryJson::FindStringField(Body.GetData(), Body.Num(), "audio_url", UrlView) &&
+                UrlView.Length > 0)
+            {
+                OutParsed.AudioUrl = VRSecretaryJson::ToString(Body.GetData(), UrlView);
+            }
+
+            OutParsed.bValid = true;
+            return;
+        }
+        // Unexpected shape; fall through to the DOM parser.
     }
+
+    const FUTF8ToTCHAR Converted((const ANSICHAR*)Body.GetData(), Body.Num());
+    ParseGatewayReplyString(FString(Converted.Length(), Converted.Get()), OutParsed);
 }
 
-void UVRSecretaryComponent::SendViaGateway(const FString& UserText)
+void UVRSecretaryComponent::ParseGatewayReplyString(const FString& Content, FParsedGatewayReply& OutParsed)
 {
-    FString Url = Settings->GatewayUrl;
-    Url.RemoveFromEnd(TEXT("/"));
-    Url += TEXT("/api/vr_chat");
+    TSharedPtr<FJsonObject> JsonObject;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_JsonParse);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, JsonParse);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(Url);
-    Request->SetVerb(TEXT("POST"));
-    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+        const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+        if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+        {
+            JsonObject.Reset();
+        }
+    }
 
-    // Build JSON payload with language support
-    TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
-    JsonObject->SetStringField(TEXT("session_id"), SessionId);
-    JsonObject->SetStringField(TEXT("user_text"), UserText);
+    if (!JsonObject.IsValid())
+    {
+        return;
+    }
 
-    // Add language field
-    const FString EffectiveLang = GetEffectiveLanguageCode();
-    JsonObject->SetStringField(TEXT("language"), EffectiveLang);
+    JsonObject->TryGetStringField(TEXT("assistant_text"), OutParsed.AssistantText);
+    JsonObject->TryGetStringField(TEXT("audio_wav_base64"), OutParsed.AudioBase64);
+    JsonObject->TryGetStringField(TEXT("audio_url"), OutParsed.AudioUrl);
+    OutParsed.bValid = true;
+}
 
-    FString Body;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Body);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-    Request->SetContentAsString(Body);
+void UVRSecretaryComponent::BroadcastGatewayReply(FParsedGatewayReply&& Parsed, const FString& CacheKey,
+                                                  double UtteranceStartSeconds, int32 GatewayUrlIndex)
+{
+    if (!Parsed.AudioBase64.IsEmpty() || Parsed.AudioWavData.Num() > 0)
+    {
+        const float AudioMs = (float)((FPlatformTime::Seconds() - UtteranceStartSeconds) * 1000.0);
+        SET_FLOAT_STAT(STAT_VRSecretary_TimeToFirstAudioMs, AudioMs);
+        CSV_CUSTOM_STAT(VRSecretary, TimeToFirstAudioMs, AudioMs, ECsvCustomStatOp::Set);
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Gateway response text: %s"), *Parsed.AssistantText);
+
+    if (!CacheKey.IsEmpty())
+    {
+        FVRSCachedResponse Cached;
+        Cached.AssistantText = Parsed.AssistantText;
+        if (Parsed.AudioWavData.Num() > 0)
+        {
+            FVRSecretaryDiskCache::Get().Add(CacheKey, Parsed.AssistantText, Parsed.AudioWavData);
+            Cached.AudioWavData = Parsed.AudioWavData;
+        }
+        else
+        {
+            PersistToDiskCache(CacheKey, Parsed.AssistantText, Parsed.AudioBase64);
+            Cached.AudioWavBase64 = Parsed.AudioBase64;
+        }
+        FVRSecretaryResponseCache::Get().Add(CacheKey, MoveTemp(Cached));
+    }
+
+    // Audio decoded on the fast path goes out as raw bytes like the binary
+    // transport does; the base64 argument is then empty so the payload is
+    // never copied into an FString.
+    OnAssistantResponse.Broadcast(Parsed.AssistantText, Parsed.AudioBase64);
+    if (Parsed.AudioWavData.Num() > 0)
+    {
+        OnAssistantAudioReady.Broadcast(Parsed.AudioWavData);
+    }
+
+    if (!Parsed.AudioUrl.IsEmpty())
+    {
+        FetchBinaryAudio(Parsed.AudioUrl, CacheKey, UtteranceStartSeconds, GatewayUrlIndex);
+    }
+}
+
+void UVRSecretaryComponent::FetchBinaryAudio(const FString& AudioUrl, const FString& CacheKey,
+                                             double UtteranceStartSeconds, int32 GatewayUrlIndex)
+{
+    // The gateway hands out a relative URL (/api/vr_audio/<token>); resolve
+    // it against the replica that issued it. Absolute URLs pass through.
+    FString Url = AudioUrl;
+    if (Url.StartsWith(TEXT("/")))
+    {
+        Url = GetGatewayBaseUrl(GatewayUrlIndex) + Url;
+    }
 
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Url);
+    Request->SetVerb(TEXT("GET"));
     Request->OnProcessRequestComplete().BindUObject(
         this,
-        &UVRSecretaryComponent::HandleGatewayResponse
+        &UVRSecretaryComponent::HandleBinaryAudioResponse
     );
-    Request->SetTimeout(Settings->HttpTimeout);
+    Request->SetTimeout(GetEffectiveHttpTimeout());
 
-    UE_LOG(LogVRSecretary, Verbose, TEXT("Sending Gateway request to %s (Language: %s)"), *Url, *EffectiveLang);
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Fetching binary audio from %s"), *Url);
+    TrackRequest(Request, CacheKey, UtteranceStartSeconds);
     Request->ProcessRequest();
 }
 
-void UVRSecretaryComponent::HandleGatewayResponse(
+void UVRSecretaryComponent::PersistToDiskCache(const FString& CacheKey, const FString& AssistantText,
+                                               const FString& AudioBase64)
+{
+    if (CacheKey.IsEmpty() || AudioBase64.IsEmpty() ||
+        !FVRSecretaryDiskCache::Get().IsEnabled() ||
+        FVRSecretaryDiskCache::Get().Contains(CacheKey))
+    {
+        return;
+    }
+
+    TArray<uint8> AudioBytes;
+    if (FBase64::Decode(AudioBase64, AudioBytes))
+    {
+        FVRSecretaryDiskCache::Get().Add(CacheKey, AssistantText, AudioBytes);
+    }
+}
+
+void UVRSecretaryComponent::HandleBinaryAudioResponse(
     FHttpRequestPtr Request,
     FHttpResponsePtr Response,
     bool bWasSuccessful)
 {
-    if (!bWasSuccessful || !Response.IsValid())
+    FInFlightRequest InFlight;
+    if (FinishRequest(Request, &InFlight))
     {
-        const FString Error = TEXT("Gateway request failed");
-        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
-        OnError.Broadcast(Error);
-        return;
+        return; // Superseded/cancelled; swallow silently.
     }
+    const FString& CacheKey = InFlight.CacheKey;
 
-    if (!EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    if (!bWasSuccessful || !Response.IsValid() ||
+        !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
     {
-        const FString Error = FString::Printf(
-            TEXT("Gateway HTTP %d: %s"),
-            Response->GetResponseCode(),
-            *Response->GetContentAsString());
+        FVRSecretaryNetworkQuality::Get().RecordFailure();
+        const FString Error = TEXT("Binary audio download failed");
         UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
         OnError.Broadcast(Error);
         return;
     }
 
-    const FString Content = Response->GetContentAsString();
+    const TArray<uint8>& AudioData = Response->GetContent();
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Binary audio received (%d bytes)"), AudioData.Num());
+
+    // Audio downloads are pure bulk transfer (no inference in the round
+    // trip), so they are the controller's best throughput signal.
+    const float DownloadMs = (float)((FPlatformTime::Seconds() - InFlight.StartTimeSeconds) * 1000.0);
+    FVRSecretaryNetworkQuality::Get().RecordSuccess(DownloadMs, AudioData.Num());
+
+    const float AudioMs = (float)((FPlatformTime::Seconds() - InFlight.UtteranceStartSeconds) * 1000.0);
+    SET_FLOAT_STAT(STAT_VRSecretary_TimeToFirstAudioMs, AudioMs);
+    CSV_CUSTOM_STAT(VRSecretary, TimeToFirstAudioMs, AudioMs, ECsvCustomStatOp::Set);
+
+    // Late-bind the downloaded WAV to the cached entry so replays of this
+    // phrase get audio too, not just text. The disk cache needs the text as
+    // well; the RAM entry added when the JSON reply arrived still has it.
+    if (!CacheKey.IsEmpty())
+    {
+        FVRSecretaryResponseCache::Get().SetAudioData(CacheKey, AudioData);
+
+        FVRSCachedResponse Cached;
+        if (FVRSecretaryDiskCache::Get().IsEnabled() &&
+            FVRSecretaryResponseCache::Get().Find(CacheKey, Cached))
+        {
+            FVRSecretaryDiskCache::Get().Add(CacheKey, Cached.AssistantText, AudioData);
+        }
+    }
+
+    OnAssistantAudioReady.Broadcast(AudioData);
+}
+
+FVRSecretaryWebSocketTransport& UVRSecretaryComponent::GetOrCreateWsTransport()
+{
+    if (!WsTransport.IsValid())
+    {
+        WsTransport = MakeShared<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe>();
+
+        TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+
+        WsTransport->OnMessage = [WeakThis](const FString& Message)
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->HandleWebSocketMessage(Message);
+            }
+        };
+
+        WsTransport->OnError = [WeakThis](const FString& Error)
+        {
+            if (WeakThis.IsValid())
+            {
+                UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
+                WeakThis->OnError.Broadcast(Error);
+            }
+        };
+    }
+
+    // Derive the ws(s):// endpoint from the configured gateway base URL.
+    FString WsUrl = Settings->GatewayUrl;
+    WsUrl.RemoveFromEnd(TEXT("/"));
+    if (WsUrl.RemoveFromStart(TEXT("https://")))
+    {
+        WsUrl = TEXT("wss://") + WsUrl;
+    }
+    else if (WsUrl.RemoveFromStart(TEXT("http://")))
+    {
+        WsUrl = TEXT("ws://") + WsUrl;
+    }
+    WsUrl += TEXT("/api/vr_chat_ws");
+    WsTransport->Configure(WsUrl);
+
+    return *WsTransport;
+}
+
+int32 UVRSecretaryComponent::SendViaGatewayWebSocket(const FString& UserText)
+{
+    FVRSecretaryWebSocketTransport& Transport = GetOrCreateWsTransport();
+
+    const FString EffectiveLang = GetEffectiveLanguageCode();
+
+    WsCacheKey = (bEnableResponseCache && !bPipelineTtsAudio)
+        ? FVRSecretaryResponseCache::MakeKey(UserText, EffectiveLang)
+        : FString();
+    WsUtteranceStartSeconds = FPlatformTime::Seconds();
+    WsAccumulatedText.Reset();
+
+    FString Body;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_RequestSerialize);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, RequestSerialize);
+
+        FVRSecretaryRequestTemplateKey Key;
+        Key.SessionId = SessionId;
+        Key.Language = EffectiveLang;
+        Key.bStream = bStreamResponses;
+        // The socket is already a streaming channel, so pipelined segments
+        // work with or without text deltas.
+        Key.bPipelineTts = bPipelineTtsAudio;
+        Key.bBinaryAudioTransport = bUseBinaryAudioTransport;
+        Key.bAcceptOpus = bAcceptOpusAudio ||
+            (bAdaptiveQuality && FVRSecretaryNetworkQuality::Get().ShouldPreferCompressedAudio());
+
+        if (!GatewayRequestTemplate.IsValid())
+        {
+            GatewayRequestTemplate = MakeUnique<FVRSecretaryRequestTemplate>();
+        }
+        GatewayRequestTemplate->EnsureCompiled(Key);
+        Body = GatewayRequestTemplate->BuildBody(UserText);
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Sending WebSocket chat frame (Language: %s)"), *EffectiveLang);
+    Transport.SendMessage(Body);
+
+    // Frames ride the shared connection; there is no per-request HTTP handle.
+    return INDEX_NONE;
+}
 
+void UVRSecretaryComponent::HandleWebSocketMessage(const FString& Message)
+{
     TSharedPtr<FJsonObject> JsonObject;
-    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_JsonParse);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, JsonParse);
+
+        const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+        if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+        {
+            JsonObject.Reset();
+        }
+    }
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!JsonObject.IsValid())
     {
-        const FString Error = TEXT("Failed to parse gateway JSON response");
+        const FString Error = TEXT("Failed to parse WebSocket frame");
         UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
         OnError.Broadcast(Error);
         return;
     }
 
+    FString ErrorMessage;
+    if (JsonObject->TryGetStringField(TEXT("error"), ErrorMessage))
+    {
+        UE_LOG(LogVRSecretary, Error, TEXT("Gateway WebSocket error: %s"), *ErrorMessage);
+        OnError.Broadcast(ErrorMessage);
+        return;
+    }
+
+    FString Delta;
+    if (JsonObject->TryGetStringField(TEXT("delta"), Delta))
+    {
+        WsAccumulatedText += Delta;
+        OnAssistantTextDelta.Broadcast(Delta, WsAccumulatedText);
+        return;
+    }
+
+    int32 SegmentIndex = INDEX_NONE;
+    if (JsonObject->TryGetNumberField(TEXT("segment"), SegmentIndex))
+    {
+        bool bLast = false;
+        JsonObject->TryGetBoolField(TEXT("last"), bLast);
+        FString SegmentAudio;
+        JsonObject->TryGetStringField(TEXT("audio_wav_base64"), SegmentAudio);
+
+        if (SegmentIndex == 0 && !SegmentAudio.IsEmpty())
+        {
+            const float AudioMs = (float)((FPlatformTime::Seconds() - WsUtteranceStartSeconds) * 1000.0);
+            SET_FLOAT_STAT(STAT_VRSecretary_TimeToFirstAudioMs, AudioMs);
+            CSV_CUSTOM_STAT(VRSecretary, TimeToFirstAudioMs, AudioMs, ECsvCustomStatOp::Set);
+        }
+        OnAssistantAudioSegment.Broadcast(SegmentIndex, bLast, SegmentAudio);
+        return;
+    }
+
+    bool bDone = false;
+    if (!JsonObject->TryGetBoolField(TEXT("done"), bDone) || !bDone)
+    {
+        return; // Unknown frame type; ignore for forward compatibility.
+    }
+
     FString AssistantText;
     FString AudioBase64;
+    FString AudioUrl;
     JsonObject->TryGetStringField(TEXT("assistant_text"), AssistantText);
     JsonObject->TryGetStringField(TEXT("audio_wav_base64"), AudioBase64);
+    JsonObject->TryGetStringField(TEXT("audio_url"), AudioUrl);
 
-    UE_LOG(LogVRSecretary, Verbose, TEXT("Gateway response text: %s"), *AssistantText);
+    if (!WsCacheKey.IsEmpty())
+    {
+        PersistToDiskCache(WsCacheKey, AssistantText, AudioBase64);
+
+        FVRSCachedResponse Cached;
+        Cached.AssistantText = AssistantText;
+        Cached.AudioWavBase64 = AudioBase64;
+        FVRSecretaryResponseCache::Get().Add(WsCacheKey, MoveTemp(Cached));
+    }
+
+    if (!AudioBase64.IsEmpty())
+    {
+        const float AudioMs = (float)((FPlatformTime::Seconds() - WsUtteranceStartSeconds) * 1000.0);
+        SET_FLOAT_STAT(STAT_VRSecretary_TimeToFirstAudioMs, AudioMs);
+        CSV_CUSTOM_STAT(VRSecretary, TimeToFirstAudioMs, AudioMs, ECsvCustomStatOp::Set);
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("WebSocket response complete (%d chars)"), AssistantText.Len());
     OnAssistantResponse.Broadcast(AssistantText, AudioBase64);
+
+    if (!AudioUrl.IsEmpty())
+    {
+        FetchBinaryAudio(AudioUrl, WsCacheKey, WsUtteranceStartSeconds);
+    }
+
+    WsCacheKey.Reset();
+    WsAccumulatedText.Reset();
 }
 
-void UVRSecretaryComponent::SendViaDirectOllama(
+int32 UVRSecretaryComponent::SendViaDirectOllama(
     const FString& UserText,
     const FVRSecretaryChatConfig& Config)
 {
@@ -198,47 +1655,96 @@ void UVRSecretaryComponent::SendViaDirectOllama(
     Request->SetVerb(TEXT("POST"));
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 
-    TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("model"), Settings->DirectOllamaModel);
-
-    TArray<TSharedPtr<FJsonValue>> Messages;
+    if (!DirectHistory.IsValid())
+    {
+        DirectHistory = MakeUnique<FVRSecretaryChatHistory>(
+            Settings->DirectOllamaMaxHistoryTurns,
+            Settings->DirectOllamaHistoryTokenBudget);
+    }
 
+    // On a constrained link the uplink body is worth real latency; let the
+    // adaptive controller shrink the history budget (and with it the cached
+    // prefix) while conditions are bad. Restores itself when they recover.
+    if (bAdaptiveQuality)
     {
-        TSharedPtr<FJsonObject> SysMsg = MakeShared<FJsonObject>();
-        SysMsg->SetStringField(TEXT("role"), TEXT("system"));
-        SysMsg->SetStringField(
-            TEXT("content"),
-            TEXT("You are Ailey, a helpful VR secretary inside a virtual office."));
-        Messages.Add(MakeShared<FJsonValueObject>(SysMsg));
+        DirectHistory->SetTokenBudget(FVRSecretaryNetworkQuality::Get().AdaptHistoryTokenBudget(
+            Settings->DirectOllamaHistoryTokenBudget));
     }
 
     {
-        TSharedPtr<FJsonObject> UserMsg = MakeShared<FJsonObject>();
-        UserMsg->SetStringField(TEXT("role"), TEXT("user"));
-        UserMsg->SetStringField(TEXT("content"), UserText);
-        Messages.Add(MakeShared<FJsonValueObject>(UserMsg));
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_RequestSerialize);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, RequestSerialize);
+
+        // The body is spliced from pre-encoded parts instead of a JSON DOM:
+        // system prompt + stable history is cached UTF-8 in DirectHistory,
+        // only the new user turn and the sampling fields are encoded here.
+        const TArray<uint8>& Prefix = DirectHistory->GetEncodedPrefixUtf8(
+            TEXT("You are Ailey, a helpful VR secretary inside a virtual office."));
+
+        const FString Head = FString::Printf(TEXT("{\"model\":%s,"),
+            *FVRSecretaryChatHistory::SerializeStringValue(Settings->DirectOllamaModel));
+
+        const FString Tail = FString::Printf(
+            TEXT(",%s],\"stream\":false,\"temperature\":%.3f,\"top_p\":%.3f,\"max_tokens\":%d}"),
+            *FVRSecretaryChatHistory::SerializeMessageObject(TEXT("user"), UserText),
+            Config.Temperature,
+            Config.TopP,
+            Config.MaxTokens);
+
+        const FTCHARToUTF8 HeadUtf8(*Head);
+        const FTCHARToUTF8 TailUtf8(*Tail);
+
+        TArray<uint8> Content;
+        Content.Reserve(HeadUtf8.Length() + Prefix.Num() + TailUtf8.Length());
+        Content.Append((const uint8*)HeadUtf8.Get(), HeadUtf8.Length());
+        Content.Append(Prefix);
+        Content.Append((const uint8*)TailUtf8.Get(), TailUtf8.Length());
+        Request->SetContent(MoveTemp(Content));
     }
 
-    Root->SetArrayField(TEXT("messages"), Messages);
-    Root->SetBoolField(TEXT("stream"), false);
+    PendingDirectUserText = UserText;
 
-    Root->SetNumberField(TEXT("temperature"), Config.Temperature);
-    Root->SetNumberField(TEXT("top_p"),       Config.TopP);
-    Root->SetNumberField(TEXT("max_tokens"),  Config.MaxTokens);
+    if (bProcessResponsesOffGameThread)
+    {
+        // Same split as the gateway path: the DOM walk over the OpenAI-shaped
+        // reply happens on the HTTP thread, only the text crosses back.
+        Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
 
-    FString Body;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Body);
-    FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
-    Request->SetContentAsString(Body);
+        TWeakObjectPtr<UVRSecretaryComponent> WeakParser(this);
+        Request->OnProcessRequestComplete().BindLambda(
+            [WeakParser](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bWasSuccessful)
+            {
+                TSharedPtr<FParsedOllamaReply> Parsed;
+                if (bWasSuccessful && Response.IsValid() &&
+                    EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+                {
+                    Parsed = MakeShared<FParsedOllamaReply>();
+                    ParseOllamaReplyBody(Response->GetContent(), *Parsed);
+                }
 
-    Request->OnProcessRequestComplete().BindUObject(
-        this,
-        &UVRSecretaryComponent::HandleDirectOllamaResponse
-    );
-    Request->SetTimeout(Settings->HttpTimeout);
+                AsyncTask(ENamedThreads::GameThread,
+                          [WeakParser, Req, Response, bWasSuccessful, Parsed]()
+                {
+                    if (WeakParser.IsValid())
+                    {
+                        WeakParser->FinishDirectOllamaResponse(Req, Response, bWasSuccessful, Parsed.Get());
+                    }
+                });
+            });
+    }
+    else
+    {
+        Request->OnProcessRequestComplete().BindUObject(
+            this,
+            &UVRSecretaryComponent::HandleDirectOllamaResponse
+        );
+    }
+    Request->SetTimeout(GetEffectiveHttpTimeout());
 
     UE_LOG(LogVRSecretary, Verbose, TEXT("Sending DirectOllama request to %s"), *Url);
+    const int32 Handle = TrackRequest(Request);
     Request->ProcessRequest();
+    return Handle;
 }
 
 void UVRSecretaryComponent::HandleDirectOllamaResponse(
@@ -246,8 +1752,28 @@ void UVRSecretaryComponent::HandleDirectOllamaResponse(
     FHttpResponsePtr Response,
     bool bWasSuccessful)
 {
+    FinishDirectOllamaResponse(Request, Response, bWasSuccessful, /*PreParsed=*/nullptr);
+}
+
+void UVRSecretaryComponent::FinishDirectOllamaResponse(
+    FHttpRequestPtr Request,
+    FHttpResponsePtr Response,
+    bool bWasSuccessful,
+    FParsedOllamaReply* PreParsed)
+{
+    FInFlightRequest InFlight;
+    if (FinishRequest(Request, &InFlight))
+    {
+        return; // Superseded/cancelled; swallow silently.
+    }
+
+    const float NetworkMs = (float)((FPlatformTime::Seconds() - InFlight.StartTimeSeconds) * 1000.0);
+    SET_FLOAT_STAT(STAT_VRSecretary_NetworkTimeMs, NetworkMs);
+    CSV_CUSTOM_STAT(VRSecretary, NetworkTimeMs, NetworkMs, ECsvCustomStatOp::Set);
+
     if (!bWasSuccessful || !Response.IsValid())
     {
+        FVRSecretaryNetworkQuality::Get().RecordFailure();
         const FString Error = TEXT("Direct Ollama request failed");
         UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
         OnError.Broadcast(Error);
@@ -256,6 +1782,7 @@ void UVRSecretaryComponent::HandleDirectOllamaResponse(
 
     if (!EHttpResponseCodes::IsOk(Response->GetResponseCode()))
     {
+        FVRSecretaryNetworkQuality::Get().RecordFailure();
         const FString Error = FString::Printf(
             TEXT("Direct Ollama HTTP %d: %s"),
             Response->GetResponseCode(),
@@ -265,34 +1792,71 @@ void UVRSecretaryComponent::HandleDirectOllamaResponse(
         return;
     }
 
-    const FString Content = Response->GetContentAsString();
+    FVRSecretaryNetworkQuality::Get().RecordSuccess(NetworkMs, Response->GetContent().Num());
+
+    FParsedOllamaReply Parsed;
+    if (PreParsed)
+    {
+        Parsed = MoveTemp(*PreParsed);
+    }
+    else
+    {
+        ParseOllamaReplyBody(Response->GetContent(), Parsed);
+    }
+
+    if (!Parsed.bValid)
+    {
+        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Parsed.Error);
+        OnError.Broadcast(Parsed.Error);
+        return;
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Direct Ollama response text: %s"), *Parsed.AssistantText);
+
+    // Remember the completed exchange so the next prompt carries it.
+    if (DirectHistory.IsValid() && !PendingDirectUserText.IsEmpty())
+    {
+        DirectHistory->AddTurn(TEXT("user"), PendingDirectUserText);
+        DirectHistory->AddTurn(TEXT("assistant"), Parsed.AssistantText);
+        PendingDirectUserText.Reset();
+    }
+
+    OnAssistantResponse.Broadcast(Parsed.AssistantText, TEXT(""));
+}
 
+void UVRSecretaryComponent::ParseOllamaReplyBody(const TArray<uint8>& Body, FParsedOllamaReply& OutParsed)
+{
     TSharedPtr<FJsonObject> JsonObject;
-    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_JsonParse);
+        CSV_SCOPED_TIMING_STAT(VRSecretary, JsonParse);
+
+        const FUTF8ToTCHAR Converted((const ANSICHAR*)Body.GetData(), Body.Num());
+        const TSharedRef<TJsonReader<>> Reader =
+            TJsonReaderFactory<>::Create(FString(Converted.Length(), Converted.Get()));
+        if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+        {
+            JsonObject.Reset();
+        }
+    }
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!JsonObject.IsValid())
     {
-        const FString Error = TEXT("Failed to parse Ollama JSON response");
-        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
-        OnError.Broadcast(Error);
+        OutParsed.Error = TEXT("Failed to parse Ollama JSON response");
         return;
     }
 
     const TArray<TSharedPtr<FJsonValue>>* Choices = nullptr;
     if (!JsonObject->TryGetArrayField(TEXT("choices"), Choices) || !Choices || Choices->Num() == 0)
     {
-        const FString Error = TEXT("Ollama response missing choices");
-        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
-        OnError.Broadcast(Error);
+        OutParsed.Error = TEXT("Ollama response missing choices");
         return;
     }
 
     TSharedPtr<FJsonObject> FirstChoice = (*Choices)[0]->AsObject();
     if (!FirstChoice.IsValid())
     {
-        const FString Error = TEXT("Ollama response missing first choice object");
-        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
-        OnError.Broadcast(Error);
+        OutParsed.Error = TEXT("Ollama response missing first choice object");
         return;
     }
 
@@ -301,29 +1865,81 @@ void UVRSecretaryComponent::HandleDirectOllamaResponse(
         !MessageObjPtr ||
         !MessageObjPtr->IsValid())
     {
-        const FString Error = TEXT("Ollama response missing message object");
-        UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
-        OnError.Broadcast(Error);
+        OutParsed.Error = TEXT("Ollama response missing message object");
         return;
     }
 
-    FString AssistantText;
-    (*MessageObjPtr)->TryGetStringField(TEXT("content"), AssistantText);
-
-    UE_LOG(LogVRSecretary, Verbose, TEXT("Direct Ollama response text: %s"), *AssistantText);
-
-    OnAssistantResponse.Broadcast(AssistantText, TEXT(""));
+    (*MessageObjPtr)->TryGetStringField(TEXT("content"), OutParsed.AssistantText);
+    OutParsed.bValid = true;
 }
 
-void UVRSecretaryComponent::SendViaLocalLlamaCpp(
+int32 UVRSecretaryComponent::SendViaLocalLlamaCpp(
     const FString& UserText,
-    const FVRSecretaryChatConfig& /*Config*/)
+    const FVRSecretaryChatConfig& Config)
 {
-    UE_LOG(
-        LogVRSecretary,
-        Warning,
-        TEXT("LocalLlamaCpp backend is not wired yet; falling back to Gateway.")
-    );
+    FVRSLlamaRunner& Runner = FVRSLlamaRunner::Get();
+    if (!Runner.IsAvailable())
+    {
+        UE_LOG(
+            LogVRSecretary,
+            Warning,
+            TEXT("LocalLlamaCpp backend unavailable (no llama.cpp build or no model loaded); falling back to Gateway.")
+        );
+        return SendViaGateway(UserText);
+    }
+
+    // Plain instruct-style prompt with the same persona as DirectOllama mode.
+    // Chat-template selection is the model's concern; keep it simple here.
+    FVRSLlamaRequest LlamaRequest;
+    LlamaRequest.Prompt = FString::Printf(
+        TEXT("System: You are Ailey, a helpful VR secretary inside a virtual office.\nUser: %s\nAssistant: "),
+        *UserText);
+    LlamaRequest.Config = Config;
+
+    // Callbacks fire on the llama worker thread; marshal to the game thread.
+    TWeakObjectPtr<UVRSecretaryComponent> WeakThis(this);
+
+    LlamaRequest.OnToken =
+        [WeakThis](const FString& TokenText, const FString& Accumulated)
+        {
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, TokenText, Accumulated]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->OnAssistantTextDelta.Broadcast(TokenText, Accumulated);
+                }
+            });
+        };
+
+    LlamaRequest.OnComplete =
+        [WeakThis](const FString& GeneratedText)
+        {
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, GeneratedText]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    // Local inference produces text only; no TTS audio.
+                    WeakThis->OnAssistantResponse.Broadcast(GeneratedText, TEXT(""));
+                }
+            });
+        };
+
+    LlamaRequest.OnFailed =
+        [WeakThis](const FString& ErrorMessage)
+        {
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, ErrorMessage]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    UE_LOG(LogVRSecretary, Error, TEXT("%s"), *ErrorMessage);
+                    WeakThis->OnError.Broadcast(ErrorMessage);
+                }
+            });
+        };
+
+    Runner.EnqueueRequest(MoveTemp(LlamaRequest));
 
-    SendViaGateway(UserText);
+    // Local inference is served from the llama worker queue, not HTTP; there
+    // is no cancellable request to hand back.
+    return INDEX_NONE;
 }
\ No newline at end of file
@@ -0,0 +1,276 @@
+#include "VRSecretaryDiskCache.h"
+#include "VRSecretaryLog.h"
+
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    constexpr uint32 DiskCacheMagic = 0x56525343; // 'VRSC'
+    constexpr uint32 DiskCacheVersion = 1;
+    constexpr int64 DiskCacheHeaderBytes = 8;
+
+    /** Per-record fixed part: key hash + two payload lengths. */
+    constexpr int64 RecordHeaderBytes = 16;
+}
+
+FVRSecretaryDiskCache& FVRSecretaryDiskCache::Get()
+{
+    static FVRSecretaryDiskCache Instance;
+    return Instance;
+}
+
+FVRSecretaryDiskCache::~FVRSecretaryDiskCache()
+{
+    CloseMapping();
+}
+
+uint64 FVRSecretaryDiskCache::HashKey(const FString& CacheKey)
+{
+    const FTCHARToUTF8 Utf8(*CacheKey);
+    return FXxHash64::HashBuffer(Utf8.Get(), Utf8.Length()).Hash;
+}
+
+void FVRSecretaryDiskCache::Initialize(int64 InCapacityBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+    CapacityBytes = InCapacityBytes;
+    if (CapacityBytes <= 0)
+    {
+        return;
+    }
+
+    FilePath = FPaths::ProjectSavedDir() / TEXT("VRSecretary") / TEXT("AudioCache.bin");
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+    // Generational eviction: an over-budget file from earlier sessions is
+    // rebuilt from scratch instead of compacted in place.
+    if (PlatformFile.FileExists(*FilePath) && PlatformFile.FileSize(*FilePath) > CapacityBytes)
+    {
+        UE_LOG(LogVRSecretary, Log, TEXT("Disk audio cache over budget; starting a fresh file"));
+        PlatformFile.DeleteFile(*FilePath);
+    }
+
+    if (!PlatformFile.FileExists(*FilePath))
+    {
+        IFileHandle* Handle = PlatformFile.OpenWrite(*FilePath);
+        if (!Handle)
+        {
+            UE_LOG(LogVRSecretary, Warning, TEXT("Disk audio cache: cannot create %s"), *FilePath);
+            CapacityBytes = 0;
+            return;
+        }
+        Handle->Write((const uint8*)&DiskCacheMagic, sizeof(DiskCacheMagic));
+        Handle->Write((const uint8*)&DiskCacheVersion, sizeof(DiskCacheVersion));
+        delete Handle;
+        FileSize = DiskCacheHeaderBytes;
+        return;
+    }
+
+    LoadIndex();
+}
+
+void FVRSecretaryDiskCache::LoadIndex()
+{
+    Index.Empty();
+    FileSize = 0;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const int64 DiskSize = PlatformFile.FileSize(*FilePath);
+    bool bValid = DiskSize >= DiskCacheHeaderBytes && EnsureMapped(DiskSize);
+
+    if (bValid)
+    {
+        const uint8* Data = MappedRegion->GetMappedPtr();
+
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        FMemory::Memcpy(&Magic, Data, sizeof(Magic));
+        FMemory::Memcpy(&Version, Data + 4, sizeof(Version));
+        bValid = Magic == DiskCacheMagic && Version == DiskCacheVersion;
+
+        int64 Offset = DiskCacheHeaderBytes;
+        while (bValid && Offset + RecordHeaderBytes <= DiskSize)
+        {
+            uint64 KeyHash = 0;
+            int32 TextBytes = 0;
+            int32 AudioBytes = 0;
+            FMemory::Memcpy(&KeyHash, Data + Offset, sizeof(KeyHash));
+            FMemory::Memcpy(&TextBytes, Data + Offset + 8, sizeof(TextBytes));
+            FMemory::Memcpy(&AudioBytes, Data + Offset + 12, sizeof(AudioBytes));
+
+            if (TextBytes < 0 || AudioBytes < 0 ||
+                Offset + RecordHeaderBytes + TextBytes + AudioBytes > DiskSize)
+            {
+                bValid = false; // Truncated record (crash mid-append).
+                break;
+            }
+
+            FEntry Entry;
+            Entry.TextOffset = Offset + RecordHeaderBytes;
+            Entry.TextBytes = TextBytes;
+            Entry.AudioOffset = Entry.TextOffset + TextBytes;
+            Entry.AudioBytes = AudioBytes;
+            Index.Add(KeyHash, Entry);
+
+            Offset += RecordHeaderBytes + TextBytes + AudioBytes;
+        }
+        bValid = bValid && Offset == DiskSize;
+        FileSize = DiskSize;
+    }
+
+    if (!bValid)
+    {
+        // Wholesale reset: the cache is a pure accelerator, so a damaged
+        // file is cheaper to rebuild than to repair.
+        UE_LOG(LogVRSecretary, Warning, TEXT("Disk audio cache damaged; rebuilding %s"), *FilePath);
+        CloseMapping();
+        Index.Empty();
+        PlatformFile.DeleteFile(*FilePath);
+
+        IFileHandle* Handle = PlatformFile.OpenWrite(*FilePath);
+        if (!Handle)
+        {
+            CapacityBytes = 0;
+            return;
+        }
+        Handle->Write((const uint8*)&DiskCacheMagic, sizeof(DiskCacheMagic));
+        Handle->Write((const uint8*)&DiskCacheVersion, sizeof(DiskCacheVersion));
+        delete Handle;
+        FileSize = DiskCacheHeaderBytes;
+        return;
+    }
+
+    UE_LOG(LogVRSecretary, Log, TEXT("Disk audio cache: %d entries, %lld bytes"),
+           Index.Num(), FileSize);
+}
+
+bool FVRSecretaryDiskCache::EnsureMapped(int64 RequiredSize)
+{
+    if (MappedRegion && (int64)MappedRegion->GetMappedSize() >= RequiredSize)
+    {
+        return true;
+    }
+
+    // Entries appended since the last mapping lie beyond it; remap the
+    // grown file (cheap — the already-resident pages stay in the page cache).
+    CloseMapping();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    MappedFile = PlatformFile.OpenMapped(*FilePath);
+    if (!MappedFile)
+    {
+        return false;
+    }
+    MappedRegion = MappedFile->MapRegion();
+    return MappedRegion != nullptr && (int64)MappedRegion->GetMappedSize() >= RequiredSize;
+}
+
+void FVRSecretaryDiskCache::CloseMapping()
+{
+    if (MappedRegion)
+    {
+        delete MappedRegion;
+        MappedRegion = nullptr;
+    }
+    if (MappedFile)
+    {
+        delete MappedFile;
+        MappedFile = nullptr;
+    }
+}
+
+bool FVRSecretaryDiskCache::IsEnabled()
+{
+    FScopeLock ScopeLock(&Lock);
+    return bInitialized && CapacityBytes > 0;
+}
+
+bool FVRSecretaryDiskCache::Contains(const FString& CacheKey)
+{
+    FScopeLock ScopeLock(&Lock);
+    return CapacityBytes > 0 && !CacheKey.IsEmpty() && Index.Contains(HashKey(CacheKey));
+}
+
+bool FVRSecretaryDiskCache::Find(const FString& CacheKey, FString& OutAssistantText,
+                                 TArray<uint8>& OutAudioBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (CapacityBytes <= 0 || CacheKey.IsEmpty())
+    {
+        return false;
+    }
+
+    const FEntry* Entry = Index.Find(HashKey(CacheKey));
+    if (!Entry || !EnsureMapped(Entry->AudioOffset + Entry->AudioBytes))
+    {
+        return false;
+    }
+
+    const uint8* Data = MappedRegion->GetMappedPtr();
+
+    const FUTF8ToTCHAR Converted((const ANSICHAR*)Data + Entry->TextOffset, Entry->TextBytes);
+    OutAssistantText = FString(Converted.Length(), Converted.Get());
+
+    OutAudioBytes.Reset();
+    OutAudioBytes.SetNumUninitialized(Entry->AudioBytes);
+    FMemory::Memcpy(OutAudioBytes.GetData(), Data + Entry->AudioOffset, Entry->AudioBytes);
+    return true;
+}
+
+void FVRSecretaryDiskCache::Add(const FString& CacheKey, const FString& AssistantText,
+                                TConstArrayView<uint8> AudioBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (CapacityBytes <= 0 || CacheKey.IsEmpty() || AudioBytes.Num() == 0)
+    {
+        return;
+    }
+
+    const uint64 KeyHash = HashKey(CacheKey);
+    if (Index.Contains(KeyHash))
+    {
+        return; // Already persisted in this or an earlier session.
+    }
+
+    const FTCHARToUTF8 TextUtf8(*AssistantText);
+    const int32 TextBytes = TextUtf8.Length();
+    const int32 NumAudioBytes = AudioBytes.Num();
+    const int64 RecordSize = RecordHeaderBytes + TextBytes + NumAudioBytes;
+    if (FileSize + RecordSize > CapacityBytes)
+    {
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Disk audio cache full; entry not persisted"));
+        return;
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    IFileHandle* Handle = PlatformFile.OpenWrite(*FilePath, /*bAppend=*/true);
+    if (!Handle)
+    {
+        return;
+    }
+    Handle->Write((const uint8*)&KeyHash, sizeof(KeyHash));
+    Handle->Write((const uint8*)&TextBytes, sizeof(TextBytes));
+    Handle->Write((const uint8*)&NumAudioBytes, sizeof(NumAudioBytes));
+    Handle->Write((const uint8*)TextUtf8.Get(), TextBytes);
+    Handle->Write(AudioBytes.GetData(), NumAudioBytes);
+    delete Handle;
+
+    FEntry Entry;
+    Entry.TextOffset = FileSize + RecordHeaderBytes;
+    Entry.TextBytes = TextBytes;
+    Entry.AudioOffset = Entry.TextOffset + TextBytes;
+    Entry.AudioBytes = NumAudioBytes;
+    Index.Add(KeyHash, Entry);
+    FileSize += RecordSize;
+
+    // Lookups remap lazily once an entry lies beyond the current mapping.
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Process-wide disk-backed audio cache that survives app restarts.
+ *
+ * The in-memory response cache dies with the process, so kiosks re-fetch and
+ * re-synthesize the same greeting lines on every launch. This cache persists
+ * assistant text + audio bytes in a single append-only file under the
+ * project's Saved directory, keyed by a 64-bit hash of the response-cache
+ * key (user text + language; voice joins the key once the plugin grows voice
+ * selection). The file is memory-mapped for lookups, so a hit hands back
+ * payload bytes straight from the page cache — one copy into the caller's
+ * buffer, no read syscalls, and the OS only faults in the entries actually
+ * touched.
+ *
+ * Record layout after an 8-byte header (magic + version):
+ *     [uint64 key hash][int32 text bytes][int32 audio bytes][text utf8][audio]
+ *
+ * Eviction is generational: a file over budget is deleted wholesale at
+ * startup and rebuilt by use. Appends stop while the budget is exhausted
+ * mid-session. Thread-safe.
+ */
+class FVRSecretaryDiskCache
+{
+public:
+    static FVRSecretaryDiskCache& Get();
+
+    /**
+     * Open (or create) the cache file and build the in-memory index.
+     * Idempotent; CapacityBytes <= 0 leaves the cache disabled.
+     */
+    void Initialize(int64 InCapacityBytes);
+
+    /** True once Initialize succeeded with a positive budget. */
+    bool IsEnabled();
+
+    /** True when the key already has a persisted entry (skip re-encoding). */
+    bool Contains(const FString& CacheKey);
+
+    /** Look up a persisted reply; copies the payloads out of the mapping. */
+    bool Find(const FString& CacheKey, FString& OutAssistantText, TArray<uint8>& OutAudioBytes);
+
+    /** Persist a reply. No-op when disabled, already present, or over budget. */
+    void Add(const FString& CacheKey, const FString& AssistantText, TConstArrayView<uint8> AudioBytes);
+
+private:
+    ~FVRSecretaryDiskCache();
+
+    struct FEntry
+    {
+        int64 TextOffset = 0;
+        int32 TextBytes = 0;
+        int64 AudioOffset = 0;
+        int32 AudioBytes = 0;
+    };
+
+    /** Parse the whole file into the index; deletes a corrupt file. */
+    void LoadIndex();
+
+    /** (Re)map the file so offsets up to RequiredSize are addressable. */
+    bool EnsureMapped(int64 RequiredSize);
+
+    void CloseMapping();
+
+    static uint64 HashKey(const FString& CacheKey);
+
+    FCriticalSection Lock;
+
+    bool bInitialized = false;
+    int64 CapacityBytes = 0;
+
+    /** Logical end of valid records (appends continue here). */
+    int64 FileSize = 0;
+
+    FString FilePath;
+    TMap<uint64, FEntry> Index;
+
+    IMappedFileHandle* MappedFile = nullptr;
+    IMappedFileRegion* MappedRegion = nullptr;
+};
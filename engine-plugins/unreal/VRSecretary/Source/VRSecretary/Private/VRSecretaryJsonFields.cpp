@@ -0,0 +1,141 @@
+#include "VRSecretaryJsonFields.h"
+
+namespace
+{
+    /** Find the byte pattern `"FieldName"` and return the index after it. */
+    int32 FindQuotedName(const uint8* Data, int32 Num, const ANSICHAR* FieldName)
+    {
+        const int32 NameLen = FCStringAnsi::Strlen(FieldName);
+        const int32 PatternLen = NameLen + 2; // Surrounding quotes.
+
+        for (int32 Index = 0; Index + PatternLen <= Num; ++Index)
+        {
+            if (Data[Index] != (uint8)'"')
+            {
+                continue;
+            }
+            if (FMemory::Memcmp(Data + Index + 1, FieldName, NameLen) == 0 &&
+                Data[Index + 1 + NameLen] == (uint8)'"')
+            {
+                return Index + PatternLen;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    bool IsJsonWhitespace(uint8 Byte)
+    {
+        return Byte == ' ' || Byte == '\t' || Byte == '\n' || Byte == '\r';
+    }
+}
+
+namespace VRSecretaryJson
+{
+
+bool FindStringField(const uint8* Data, int32 Num, const ANSICHAR* FieldName, FStringFieldView& OutView)
+{
+    OutView = FStringFieldView();
+
+    int32 Index = FindQuotedName(Data, Num, FieldName);
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    while (Index < Num && IsJsonWhitespace(Data[Index]))
+    {
+        ++Index;
+    }
+    if (Index >= Num || Data[Index] != (uint8)':')
+    {
+        return false;
+    }
+    ++Index;
+    while (Index < Num && IsJsonWhitespace(Data[Index]))
+    {
+        ++Index;
+    }
+    if (Index >= Num || Data[Index] != (uint8)'"')
+    {
+        return false; // null, number, or object — not a string value.
+    }
+    ++Index;
+
+    const int32 ValueStart = Index;
+    bool bHasEscapes = false;
+    while (Index < Num)
+    {
+        const uint8 Byte = Data[Index];
+        if (Byte == (uint8)'\\')
+        {
+            bHasEscapes = true;
+            Index += 2; // Skip the escaped character (incl. an escaped quote).
+            continue;
+        }
+        if (Byte == (uint8)'"')
+        {
+            OutView.Offset = ValueStart;
+            OutView.Length = Index - ValueStart;
+            OutView.bHasEscapes = bHasEscapes;
+            return true;
+        }
+        ++Index;
+    }
+    return false; // Unterminated string.
+}
+
+FString ToString(const uint8* Data, const FStringFieldView& View)
+{
+    if (!View.IsSet() || View.Length <= 0)
+    {
+        return FString();
+    }
+
+    const FUTF8ToTCHAR Converted((const ANSICHAR*)Data + View.Offset, View.Length);
+    FString Result(Converted.Length(), Converted.Get());
+
+    if (!View.bHasEscapes)
+    {
+        return Result;
+    }
+
+    // Unescape in a second pass; escapes are rare outside assistant text.
+    FString Unescaped;
+    Unescaped.Reserve(Result.Len());
+    for (int32 Index = 0; Index < Result.Len(); ++Index)
+    {
+        const TCHAR Ch = Result[Index];
+        if (Ch != TEXT('\\') || Index + 1 >= Result.Len())
+        {
+            Unescaped.AppendChar(Ch);
+            continue;
+        }
+
+        const TCHAR Next = Result[++Index];
+        switch (Next)
+        {
+        case TEXT('"'):  Unescaped.AppendChar(TEXT('"'));  break;
+        case TEXT('\\'): Unescaped.AppendChar(TEXT('\\')); break;
+        case TEXT('/'):  Unescaped.AppendChar(TEXT('/'));  break;
+        case TEXT('n'):  Unescaped.AppendChar(TEXT('\n')); break;
+        case TEXT('r'):  Unescaped.AppendChar(TEXT('\r')); break;
+        case TEXT('t'):  Unescaped.AppendChar(TEXT('\t')); break;
+        case TEXT('b'):  Unescaped.AppendChar(TEXT('\b')); break;
+        case TEXT('f'):  Unescaped.AppendChar(TEXT('\f')); break;
+        case TEXT('u'):
+            if (Index + 4 < Result.Len())
+            {
+                TCHAR Hex[5] = { Result[Index + 1], Result[Index + 2], Result[Index + 3], Result[Index + 4], 0 };
+                Unescaped.AppendChar((TCHAR)FCString::Strtoi(Hex, nullptr, 16));
+                Index += 4;
+            }
+            break;
+        default:
+            Unescaped.AppendChar(Next);
+            break;
+        }
+    }
+    return Unescaped;
+}
+
+} // namespace VRSecretaryJson
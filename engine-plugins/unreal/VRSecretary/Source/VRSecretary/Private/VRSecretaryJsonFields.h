@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Targeted string-field extraction over a raw UTF-8 JSON body.
+ *
+ * The gateway's reply is a flat object whose bulk is one giant
+ * audio_wav_base64 string. Converting the whole body to TCHAR and building
+ * a JSON DOM just to pull out two fields copies the audio payload three
+ * times before the decoder sees it; these helpers instead scan the raw
+ * bytes and hand values back by offset/length view.
+ *
+ * This is a scanner for the gateway's known flat response shape, not a
+ * general JSON parser: it assumes the field name does not also appear
+ * inside a preceding string value.
+ */
+namespace VRSecretaryJson
+{
+    /** A located string value inside the raw body (quotes excluded). */
+    struct FStringFieldView
+    {
+        /** Byte offset of the first value byte, or INDEX_NONE. */
+        int32 Offset = INDEX_NONE;
+
+        /** Value length in bytes. */
+        int32 Length = 0;
+
+        /** True when the value contains backslash escapes. */
+        bool bHasEscapes = false;
+
+        bool IsSet() const { return Offset != INDEX_NONE; }
+    };
+
+    /** Locate "FieldName":"value" in the body. Returns false when absent or null. */
+    bool FindStringField(const uint8* Data, int32 Num, const ANSICHAR* FieldName, FStringFieldView& OutView);
+
+    /** Convert a located value to FString (UTF-8 conversion + JSON unescape). */
+    FString ToString(const uint8* Data, const FStringFieldView& View);
+}
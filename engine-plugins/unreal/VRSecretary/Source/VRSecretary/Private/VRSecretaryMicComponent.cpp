@@ -0,0 +1,388 @@
+#include "VRSecretaryMicComponent.h"
+#include "VRSecretaryAudioRingBuffer.h"
+#include "VRSecretaryComponent.h"
+#include "VRSecretaryLog.h"
+#include "VRSecretarySettings.h"
+#include "VRSecretaryStats.h"
+#include "VRSecretaryWebSocketTransport.h"
+
+#include "AudioCaptureCore.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+UVRSecretaryMicComponent::UVRSecretaryMicComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+UVRSecretaryMicComponent::~UVRSecretaryMicComponent() = default;
+
+void UVRSecretaryMicComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (bAutoStartCapture)
+    {
+        StartCapture();
+    }
+}
+
+void UVRSecretaryMicComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    StopCapture();
+
+    if (SttTransport.IsValid())
+    {
+        SttTransport->Close();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+bool UVRSecretaryMicComponent::StartCapture()
+{
+    if (bCapturing)
+    {
+        return true;
+    }
+
+    if (!AudioCapture.IsValid())
+    {
+        AudioCapture = MakeUnique<Audio::FAudioCapture>();
+    }
+
+    Audio::FCaptureDeviceInfo DeviceInfo;
+    if (!AudioCapture->GetCaptureDeviceInfo(DeviceInfo))
+    {
+        const FString Error = TEXT("No audio capture device available");
+        UE_LOG(LogVRSecretary, Warning, TEXT("%s"), *Error);
+        OnError.Broadcast(Error);
+        return false;
+    }
+
+    CaptureSampleRate = DeviceInfo.PreferredSampleRate;
+    SamplesPerFrame = FMath::Max(1, CaptureSampleRate * FrameDurationMs / 1000);
+
+    // One second of backlog: enough to ride out a long game-thread hitch
+    // without the capture callback ever waiting on the consumer.
+    if (!CaptureRing.IsValid())
+    {
+        CaptureRing = MakeUnique<FVRSecretaryAudioRingBuffer>();
+    }
+    CaptureRing->Initialize(CaptureSampleRate);
+
+    FrameAssembly.SetNumUninitialized(SamplesPerFrame);
+    FrameFill = 0;
+    DrainScratch.SetNumUninitialized(FMath::Max(SamplesPerFrame * 4, 4096));
+
+    PrerollFrameCapacity = FMath::Max(1, FMath::CeilToInt(VadPrerollMs / (float)FrameDurationMs));
+    PrerollRing.SetNumUninitialized(PrerollFrameCapacity * SamplesPerFrame);
+    PrerollWriteFrame = 0;
+    PrerollFramesStored = 0;
+
+    bSpeechActive = false;
+    HangoverFramesLeft = 0;
+    LastReportedDrops = CaptureRing->GetDroppedSampleCount();
+
+    // The ring outlives the stream (closed in StopCapture before teardown),
+    // so the callback captures it raw. Everything in here runs on the audio
+    // render thread: fixed stack scratch, arithmetic and the lock-free push —
+    // no allocation, no locks, no engine calls.
+    FVRSecretaryAudioRingBuffer* Ring = CaptureRing.Get();
+    Audio::FOnAudioCaptureFunction OnCapture =
+        [Ring](const void* InAudio, int32 NumFrames, int32 NumChannels,
+               int32 InSampleRate, double StreamTime, bool bOverflow)
+    {
+        const float* Src = (const float*)InAudio;
+        int16 Mono[512];
+
+        int32 Frame = 0;
+        while (Frame < NumFrames)
+        {
+            const int32 Chunk = FMath::Min(NumFrames - Frame, 512);
+            for (int32 Index = 0; Index < Chunk; ++Index)
+            {
+                const float* Interleaved = Src + (Frame + Index) * NumChannels;
+                float Sum = 0.0f;
+                for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+                {
+                    Sum += Interleaved[Channel];
+                }
+                const float Sample = Sum / (float)NumChannels;
+                Mono[Index] = (int16)FMath::Clamp((int32)(Sample * 32767.0f), -32768, 32767);
+            }
+            Ring->Push(Mono, Chunk);
+            Frame += Chunk;
+        }
+    };
+
+    Audio::FAudioCaptureDeviceParams Params;
+    if (!AudioCapture->OpenAudioCaptureStream(Params, MoveTemp(OnCapture), 1024) ||
+        !AudioCapture->StartStream())
+    {
+        const FString Error = TEXT("Failed to open the audio capture stream");
+        UE_LOG(LogVRSecretary, Warning, TEXT("%s"), *Error);
+        OnError.Broadcast(Error);
+        return false;
+    }
+
+    UE_LOG(LogVRSecretary, Log, TEXT("Mic capture started (%d Hz, %d ms frames)"),
+           CaptureSampleRate, FrameDurationMs);
+
+    bCapturing = true;
+    SetComponentTickEnabled(true);
+    return true;
+}
+
+void UVRSecretaryMicComponent::StopCapture()
+{
+    if (!bCapturing)
+    {
+        return;
+    }
+
+    if (AudioCapture.IsValid())
+    {
+        AudioCapture->StopStream();
+        AudioCapture->CloseStream();
+    }
+
+    // Producer is stopped; flush whatever VAD state is left.
+    if (bSpeechActive)
+    {
+        EndUtterance();
+    }
+    CaptureRing->Reset();
+    FrameFill = 0;
+    PrerollFramesStored = 0;
+
+    bCapturing = false;
+    SetComponentTickEnabled(false);
+
+    UE_LOG(LogVRSecretary, Log, TEXT("Mic capture stopped"));
+}
+
+bool UVRSecretaryMicComponent::IsCapturing() const
+{
+    return bCapturing;
+}
+
+void UVRSecretaryMicComponent::TickComponent(float DeltaTime, ELevelTick TickType,
+                                             FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!bCapturing)
+    {
+        return;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_VRSecretary_MicFrameProcess);
+
+    int32 Popped;
+    while ((Popped = CaptureRing->Pop(DrainScratch.GetData(), DrainScratch.Num())) > 0)
+    {
+        int32 Offset = 0;
+        while (Offset < Popped)
+        {
+            const int32 ToCopy = FMath::Min(SamplesPerFrame - FrameFill, Popped - Offset);
+            FMemory::Memcpy(FrameAssembly.GetData() + FrameFill, DrainScratch.GetData() + Offset,
+                            ToCopy * sizeof(int16));
+            FrameFill += ToCopy;
+            Offset += ToCopy;
+
+            if (FrameFill == SamplesPerFrame)
+            {
+                ProcessFrame(FrameAssembly.GetData(), SamplesPerFrame);
+                FrameFill = 0;
+            }
+        }
+    }
+
+    const uint64 Drops = CaptureRing->GetDroppedSampleCount();
+    if (Drops != LastReportedDrops)
+    {
+        UE_LOG(LogVRSecretary, Warning, TEXT("Mic capture dropped %llu samples (consumer fell behind)"),
+               Drops - LastReportedDrops);
+        LastReportedDrops = Drops;
+    }
+}
+
+void UVRSecretaryMicComponent::ProcessFrame(const int16* Samples, int32 NumSamples)
+{
+    float SumSquares = 0.0f;
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        const float Sample = Samples[Index] * (1.0f / 32768.0f);
+        SumSquares += Sample * Sample;
+    }
+    const float Rms = FMath::Sqrt(SumSquares / (float)NumSamples);
+    const float Db = 20.0f * FMath::LogX(10.0f, FMath::Max(Rms, 1.0e-6f));
+    const bool bVoiced = Db >= VadThresholdDb;
+
+    const int32 FrameBytes = NumSamples * sizeof(int16);
+
+    if (!bSpeechActive)
+    {
+        if (!bVoiced)
+        {
+            // Idle: keep the newest frames around as pre-roll.
+            FMemory::Memcpy(PrerollRing.GetData() + PrerollWriteFrame * SamplesPerFrame,
+                            Samples, FrameBytes);
+            PrerollWriteFrame = (PrerollWriteFrame + 1) % PrerollFrameCapacity;
+            PrerollFramesStored = FMath::Min(PrerollFramesStored + 1, PrerollFrameCapacity);
+            return;
+        }
+
+        BeginUtterance();
+
+        // Ship the pre-roll (oldest first) so the onset isn't clipped.
+        FVRSecretaryWebSocketTransport& Transport = GetOrCreateSttTransport();
+        for (int32 Index = 0; Index < PrerollFramesStored; ++Index)
+        {
+            const int32 FrameSlot =
+                (PrerollWriteFrame - PrerollFramesStored + Index + PrerollFrameCapacity) % PrerollFrameCapacity;
+            Transport.SendBinary(PrerollRing.GetData() + FrameSlot * SamplesPerFrame, FrameBytes);
+        }
+        PrerollFramesStored = 0;
+    }
+
+    GetOrCreateSttTransport().SendBinary(Samples, FrameBytes);
+
+    if (bVoiced)
+    {
+        HangoverFramesLeft = FMath::Max(1, FMath::CeilToInt(VadHangoverMs / (float)FrameDurationMs));
+    }
+    else if (--HangoverFramesLeft <= 0)
+    {
+        EndUtterance();
+    }
+}
+
+void UVRSecretaryMicComponent::BeginUtterance()
+{
+    const UVRSecretarySettings* Settings = GetDefault<UVRSecretarySettings>();
+    FString EffectiveLang = LanguageCode.IsEmpty() ? Settings->DefaultLanguageCode : LanguageCode;
+
+    FString SessionId;
+    if (const UVRSecretaryComponent* Chat =
+            GetOwner() ? GetOwner()->FindComponentByClass<UVRSecretaryComponent>() : nullptr)
+    {
+        SessionId = Chat->SessionId;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+    JsonObject->SetStringField(TEXT("type"), TEXT("stt_begin"));
+    JsonObject->SetStringField(TEXT("session_id"), SessionId);
+    JsonObject->SetNumberField(TEXT("sample_rate"), CaptureSampleRate);
+    JsonObject->SetNumberField(TEXT("channels"), 1);
+    JsonObject->SetStringField(TEXT("format"), TEXT("pcm_s16le"));
+    JsonObject->SetStringField(TEXT("language"), EffectiveLang);
+
+    FString Body;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Body);
+    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+    GetOrCreateSttTransport().SendMessage(Body);
+
+    bSpeechActive = true;
+    OnSpeechStarted.Broadcast();
+}
+
+void UVRSecretaryMicComponent::EndUtterance()
+{
+    GetOrCreateSttTransport().SendMessage(TEXT("{\"type\":\"stt_end\"}"));
+
+    bSpeechActive = false;
+    HangoverFramesLeft = 0;
+    OnSpeechEnded.Broadcast();
+}
+
+FVRSecretaryWebSocketTransport& UVRSecretaryMicComponent::GetOrCreateSttTransport()
+{
+    const UVRSecretarySettings* Settings = GetDefault<UVRSecretarySettings>();
+
+    if (!SttTransport.IsValid())
+    {
+        SttTransport = MakeShared<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe>();
+
+        TWeakObjectPtr<UVRSecretaryMicComponent> WeakThis(this);
+
+        SttTransport->OnMessage = [WeakThis](const FString& Message)
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->HandleSttMessage(Message);
+            }
+        };
+
+        SttTransport->OnError = [WeakThis](const FString& Error)
+        {
+            if (WeakThis.IsValid())
+            {
+                UE_LOG(LogVRSecretary, Error, TEXT("%s"), *Error);
+                WeakThis->OnError.Broadcast(Error);
+            }
+        };
+    }
+
+    // Derive the ws(s):// endpoint from the configured gateway base URL.
+    FString WsUrl = Settings->GatewayUrl;
+    WsUrl.RemoveFromEnd(TEXT("/"));
+    if (WsUrl.RemoveFromStart(TEXT("https://")))
+    {
+        WsUrl = TEXT("wss://") + WsUrl;
+    }
+    else if (WsUrl.RemoveFromStart(TEXT("http://")))
+    {
+        WsUrl = TEXT("ws://") + WsUrl;
+    }
+    WsUrl += TEXT("/ws/stt");
+    SttTransport->Configure(WsUrl);
+
+    return *SttTransport;
+}
+
+void UVRSecretaryMicComponent::HandleSttMessage(const FString& Message)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogVRSecretary, Warning, TEXT("STT frame is not valid JSON: %s"), *Message);
+        return;
+    }
+
+    const FString Type = JsonObject->GetStringField(TEXT("type"));
+
+    if (Type == TEXT("transcript"))
+    {
+        FString Text;
+        JsonObject->TryGetStringField(TEXT("text"), Text);
+        bool bFinal = false;
+        JsonObject->TryGetBoolField(TEXT("final"), bFinal);
+
+        OnTranscript.Broadcast(Text, bFinal);
+
+        if (bFinal && bAutoSendFinalTranscript && !Text.IsEmpty())
+        {
+            if (UVRSecretaryComponent* Chat =
+                    GetOwner() ? GetOwner()->FindComponentByClass<UVRSecretaryComponent>() : nullptr)
+            {
+                Chat->SendUserText(Text, FVRSecretaryChatConfig());
+            }
+        }
+        return;
+    }
+
+    if (Type == TEXT("error"))
+    {
+        FString Error;
+        JsonObject->TryGetStringField(TEXT("message"), Error);
+        UE_LOG(LogVRSecretary, Error, TEXT("STT error: %s"), *Error);
+        OnError.Broadcast(Error);
+    }
+}
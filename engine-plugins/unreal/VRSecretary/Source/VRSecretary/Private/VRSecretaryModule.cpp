@@ -1,5 +1,6 @@
 #include "Modules/ModuleManager.h"
 #include "VRSecretaryLog.h"
+#include "VRSLlamaRunner.h"
 
 class FVRSecretaryModule : public IModuleInterface
 {
@@ -7,11 +8,18 @@ public:
     virtual void StartupModule() override
     {
         UE_LOG(LogVRSecretary, Log, TEXT("VRSecretary module starting up"));
+
+        // Kick off the local llama.cpp model load (mmap) on its worker thread
+        // so the model is warm before the first LocalLlamaCpp request. No-op
+        // when built without llama.cpp or when no model path is configured.
+        FVRSLlamaRunner::Get().StartupAsync();
     }
 
     virtual void ShutdownModule() override
     {
         UE_LOG(LogVRSecretary, Log, TEXT("VRSecretary module shutting down"));
+
+        FVRSLlamaRunner::Get().Shutdown();
     }
 };
 
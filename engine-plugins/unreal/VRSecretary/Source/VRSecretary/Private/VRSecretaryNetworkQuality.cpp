@@ -0,0 +1,176 @@
+#include "VRSecretaryNetworkQuality.h"
+
+FVRSecretaryNetworkQuality& FVRSecretaryNetworkQuality::Get()
+{
+    static FVRSecretaryNetworkQuality Instance;
+    return Instance;
+}
+
+void FVRSecretaryNetworkQuality::RecordSuccess(float RttMs, int64 PayloadBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    if (RttMs > 0.0f)
+    {
+        if (NumRttSamples == 0)
+        {
+            SmoothedRttMs = RttMs;
+            RttJitterMs = 0.0f;
+        }
+        else
+        {
+            // Jitter first, against the previous mean, so a level shift
+            // registers as variation before the mean catches up.
+            RttJitterMs = FMath::Lerp(RttJitterMs, FMath::Abs(RttMs - SmoothedRttMs), Alpha);
+            SmoothedRttMs = FMath::Lerp(SmoothedRttMs, RttMs, Alpha);
+        }
+        ++NumRttSamples;
+
+        if (PayloadBytes >= ThroughputMinPayloadBytes)
+        {
+            const float Bps = (float)PayloadBytes / (RttMs / 1000.0f);
+            SmoothedThroughputBps = NumThroughputSamples == 0
+                ? Bps
+                : FMath::Lerp(SmoothedThroughputBps, Bps, Alpha);
+            ++NumThroughputSamples;
+        }
+    }
+
+    FailureRate = FMath::Lerp(FailureRate, 0.0f, Alpha);
+    ++NumSamples;
+}
+
+void FVRSecretaryNetworkQuality::RecordFailure()
+{
+    FScopeLock ScopeLock(&Lock);
+    FailureRate = FMath::Lerp(FailureRate, 1.0f, Alpha);
+    ++NumSamples;
+}
+
+void FVRSecretaryNetworkQuality::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    SmoothedRttMs = 0.0f;
+    RttJitterMs = 0.0f;
+    SmoothedThroughputBps = 0.0f;
+    FailureRate = 0.0f;
+    NumRttSamples = 0;
+    NumThroughputSamples = 0;
+    NumSamples = 0;
+}
+
+float FVRSecretaryNetworkQuality::GetSmoothedRttMs() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return SmoothedRttMs;
+}
+
+float FVRSecretaryNetworkQuality::GetRttJitterMs() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return RttJitterMs;
+}
+
+float FVRSecretaryNetworkQuality::GetSmoothedThroughputBps() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return SmoothedThroughputBps;
+}
+
+float FVRSecretaryNetworkQuality::GetFailureRate() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return FailureRate;
+}
+
+int32 FVRSecretaryNetworkQuality::GetNumSamples() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return NumSamples;
+}
+
+EVRSecretaryNetworkTier FVRSecretaryNetworkQuality::GetTier() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return ClassifyTier();
+}
+
+EVRSecretaryNetworkTier FVRSecretaryNetworkQuality::ClassifyTier() const
+{
+    if (NumSamples < MinSamplesForTier)
+    {
+        return EVRSecretaryNetworkTier::Unknown;
+    }
+
+    // The tier rides the network-isolating signals. The smoothed round-trip
+    // is left out on purpose: it blends server inference time, so a slow
+    // model on a perfect LAN must not read as a bad link.
+    const bool bHasThroughput = NumThroughputSamples > 0;
+    if (FailureRate > PoorFailureRate ||
+        (bHasThroughput && SmoothedThroughputBps < PoorThroughputBps))
+    {
+        return EVRSecretaryNetworkTier::Poor;
+    }
+    if (FailureRate < GoodFailureRate &&
+        (!bHasThroughput || SmoothedThroughputBps > GoodThroughputBps))
+    {
+        return EVRSecretaryNetworkTier::Good;
+    }
+    return EVRSecretaryNetworkTier::Degraded;
+}
+
+float FVRSecretaryNetworkQuality::AdaptTimeoutSeconds(float BaseSeconds) const
+{
+    FScopeLock ScopeLock(&Lock);
+    if (NumSamples < MinSamplesForTier || NumRttSamples == 0)
+    {
+        return BaseSeconds;
+    }
+
+    // Twice the expected worst-typical completion time, so a routinely slow
+    // venue doesn't turn every long answer into a spurious timeout. Only
+    // ever extends the configured base, and by at most 3x.
+    const float ExpectedSeconds = (SmoothedRttMs + 4.0f * RttJitterMs) / 1000.0f;
+    return FMath::Max(BaseSeconds, FMath::Min(ExpectedSeconds * 2.0f, BaseSeconds * 3.0f));
+}
+
+float FVRSecretaryNetworkQuality::AdaptHedgeThresholdSeconds(float BaseSeconds) const
+{
+    FScopeLock ScopeLock(&Lock);
+    if (NumSamples < MinSamplesForTier || NumRttSamples == 0)
+    {
+        return BaseSeconds;
+    }
+
+    // Hedge as soon as a request falls outside its typical envelope: a
+    // static threshold tuned for the worst venue wastes the whole window on
+    // a fast one. Never hedges earlier than 50 ms or later than configured.
+    const float Candidate = (SmoothedRttMs + 3.0f * RttJitterMs) / 1000.0f;
+    return FMath::Clamp(Candidate, 0.05f, BaseSeconds);
+}
+
+bool FVRSecretaryNetworkQuality::ShouldPreferCompressedAudio() const
+{
+    const EVRSecretaryNetworkTier Tier = GetTier();
+    return Tier == EVRSecretaryNetworkTier::Degraded || Tier == EVRSecretaryNetworkTier::Poor;
+}
+
+bool FVRSecretaryNetworkQuality::ShouldPreferStreaming() const
+{
+    return GetTier() == EVRSecretaryNetworkTier::Poor;
+}
+
+int32 FVRSecretaryNetworkQuality::AdaptHistoryTokenBudget(int32 BaseBudget) const
+{
+    switch (GetTier())
+    {
+    case EVRSecretaryNetworkTier::Degraded:
+        return BaseBudget > 0 ? FMath::Max(MinAdaptedTokenBudget, BaseBudget * 3 / 4) : BaseBudget;
+    case EVRSecretaryNetworkTier::Poor:
+        return BaseBudget > 0
+            ? FMath::Max(MinAdaptedTokenBudget, BaseBudget / 2)
+            : PoorUnlimitedTokenBudget;
+    default:
+        return BaseBudget;
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VRSecretaryChatTypes.h"
+
+/**
+ * Process-wide feedback controller for the link to the backend.
+ *
+ * Deployments range from LAN gateways (milliseconds) to congested venue
+ * Wi-Fi (hundreds of milliseconds, lossy), and hand-tuning per-venue config
+ * files does not scale. The request handlers feed every completed request
+ * in here — wall-clock round-trip, payload size, success/failure — and the
+ * controller keeps exponentially weighted moving averages plus a coarse
+ * tier classification that the component consults (when bAdaptiveQuality is
+ * on) to pick timeouts, hedge thresholds, audio codec, streaming mode and
+ * history budget per send.
+ *
+ * The round-trip sample deliberately blends wire time with server inference
+ * time — for timeout and hedge decisions total completion time is exactly
+ * the quantity that matters. The tier therefore leans on the signals that
+ * isolate the network: failure rate and bulk-payload throughput (small
+ * replies measure the server, not the pipe, and are excluded from the
+ * throughput average). Thread-safe; the off-game-thread completion path
+ * records from the HTTP thread.
+ */
+class FVRSecretaryNetworkQuality
+{
+public:
+    static FVRSecretaryNetworkQuality& Get();
+
+    /** Record a completed request: total round-trip and response payload size. */
+    void RecordSuccess(float RttMs, int64 PayloadBytes);
+
+    /** Record a transport error or HTTP failure. */
+    void RecordFailure();
+
+    /** Forget all measurements (back to Unknown). */
+    void Reset();
+
+    float GetSmoothedRttMs() const;
+    float GetRttJitterMs() const;
+    float GetSmoothedThroughputBps() const;
+    float GetFailureRate() const;
+    int32 GetNumSamples() const;
+    EVRSecretaryNetworkTier GetTier() const;
+
+    /**
+     * Timeout adapted to measured completion times: extended up to 3x the
+     * configured base when requests routinely run long, never shortened
+     * below it. Unknown tier returns the base unchanged.
+     */
+    float AdaptTimeoutSeconds(float BaseSeconds) const;
+
+    /**
+     * Hedge threshold tightened to just above typical completion time on
+     * links whose tail is jitter rather than baseline slowness; never
+     * loosened beyond the configured base.
+     */
+    float AdaptHedgeThresholdSeconds(float BaseSeconds) const;
+
+    /** Advertise Opus when the link can no longer afford PCM WAV. */
+    bool ShouldPreferCompressedAudio() const;
+
+    /** Ask for streamed replies so partial text lands early on slow links. */
+    bool ShouldPreferStreaming() const;
+
+    /**
+     * History token budget shrunk on constrained links so the uplink
+     * payload (and its serialization) stays small: 3/4 when Degraded, half
+     * when Poor. An unlimited base (0) is capped only when Poor.
+     */
+    int32 AdaptHistoryTokenBudget(int32 BaseBudget) const;
+
+private:
+    EVRSecretaryNetworkTier ClassifyTier() const; // Caller holds Lock.
+
+    /** EWMA smoothing factor for all averages. */
+    static constexpr float Alpha = 0.2f;
+
+    /** Samples required before the tier leaves Unknown. */
+    static constexpr int32 MinSamplesForTier = 5;
+
+    /** Payloads below this measure the server, not the pipe; skipped for throughput. */
+    static constexpr int64 ThroughputMinPayloadBytes = 8 * 1024;
+
+    static constexpr float GoodThroughputBps = 1024.0f * 1024.0f;
+    static constexpr float PoorThroughputBps = 256.0f * 1024.0f;
+    static constexpr float GoodFailureRate = 0.05f;
+    static constexpr float PoorFailureRate = 0.2f;
+
+    /** Token budget imposed on Poor links when the configured budget is unlimited. */
+    static constexpr int32 PoorUnlimitedTokenBudget = 2048;
+    static constexpr int32 MinAdaptedTokenBudget = 256;
+
+    mutable FCriticalSection Lock;
+
+    float SmoothedRttMs = 0.0f;
+    float RttJitterMs = 0.0f;
+    float SmoothedThroughputBps = 0.0f;
+    float FailureRate = 0.0f;
+    int32 NumRttSamples = 0;
+    int32 NumThroughputSamples = 0;
+    int32 NumSamples = 0;
+};
@@ -0,0 +1,87 @@
+#include "VRSecretaryRequestScheduler.h"
+#include "VRSecretarySettings.h"
+#include "VRSecretaryLog.h"
+
+void UVRSecretaryRequestScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    MaxConcurrent = GetDefault<UVRSecretarySettings>()->MaxConcurrentGatewayRequests;
+    UE_LOG(LogVRSecretary, Log, TEXT("Request scheduler initialized (budget: %d concurrent)"),
+           MaxConcurrent);
+}
+
+void UVRSecretaryRequestScheduler::Enqueue(UObject* Owner, int32 Priority, TFunction<bool()>&& Dispatch)
+{
+    FQueuedDispatch Entry;
+    Entry.Owner = Owner;
+    Entry.Priority = Priority;
+    Entry.Dispatch = MoveTemp(Dispatch);
+
+    // Insert after the last entry of equal or higher priority so equal
+    // priorities stay FIFO. Interactive entries also hop over any trailing
+    // prefetches, which rank below every priority.
+    int32 InsertIndex = Queue.Num();
+    while (InsertIndex > 0 &&
+           (Queue[InsertIndex - 1].bPrefetch || Queue[InsertIndex - 1].Priority < Priority))
+    {
+        --InsertIndex;
+    }
+    Queue.Insert(MoveTemp(Entry), InsertIndex);
+
+    Pump();
+}
+
+void UVRSecretaryRequestScheduler::EnqueuePrefetch(UObject* Owner, TFunction<bool()>&& Dispatch)
+{
+    FQueuedDispatch Entry;
+    Entry.Owner = Owner;
+    Entry.bPrefetch = true;
+    Entry.Dispatch = MoveTemp(Dispatch);
+
+    // Prefetches trail the whole queue, FIFO among themselves.
+    Queue.Add(MoveTemp(Entry));
+
+    Pump();
+}
+
+void UVRSecretaryRequestScheduler::CancelQueued(UObject* Owner)
+{
+    Queue.RemoveAll([Owner](const FQueuedDispatch& Entry)
+    {
+        return !Entry.bPrefetch && Entry.Owner.Get() == Owner;
+    });
+}
+
+void UVRSecretaryRequestScheduler::NotifyRequestFinished()
+{
+    NumActive = FMath::Max(0, NumActive - 1);
+    Pump();
+}
+
+int32 UVRSecretaryRequestScheduler::GetBudgetFor(const FQueuedDispatch& Entry) const
+{
+    if (!Entry.bPrefetch)
+    {
+        return MaxConcurrent;
+    }
+    // Prefetches leave one slot free for interactive arrivals. With a budget
+    // of one there is nothing to reserve without starving prefetch entirely,
+    // so they fall back to using the idle slot.
+    return FMath::Max(1, MaxConcurrent - 1);
+}
+
+void UVRSecretaryRequestScheduler::Pump()
+{
+    while (Queue.Num() > 0 && (MaxConcurrent <= 0 || NumActive < GetBudgetFor(Queue[0])))
+    {
+        FQueuedDispatch Entry = MoveTemp(Queue[0]);
+        Queue.RemoveAt(0, 1, /*bAllowShrinking=*/false);
+
+        if (Entry.Dispatch && Entry.Dispatch())
+        {
+            ++NumActive;
+        }
+        // else: owner died or the entry was superseded; costs no slot.
+    }
+}
@@ -0,0 +1,58 @@
+#include "VRSecretaryRequestTemplate.h"
+
+#include "VRSecretaryChatHistory.h"
+
+void FVRSecretaryRequestTemplate::EnsureCompiled(const FVRSecretaryRequestTemplateKey& Key)
+{
+    if (bCompiled && CompiledKey == Key)
+    {
+        return;
+    }
+
+    // Field order matches what the DOM serialization historically produced,
+    // so wire captures stay diffable across plugin versions.
+    Prefix = FString::Printf(TEXT("{\"session_id\":%s,\"user_text\":"),
+        *FVRSecretaryChatHistory::SerializeStringValue(Key.SessionId));
+
+    Suffix = FString::Printf(TEXT(",\"language\":%s"),
+        *FVRSecretaryChatHistory::SerializeStringValue(Key.Language));
+
+    if (Key.bStream)
+    {
+        Suffix += TEXT(",\"stream\":true");
+    }
+
+    if (Key.bPipelineTts)
+    {
+        Suffix += TEXT(",\"pipeline_tts\":true");
+    }
+
+    if (Key.bBinaryAudioTransport)
+    {
+        Suffix += TEXT(",\"audio_transport\":\"url\"");
+    }
+
+    if (Key.bAcceptOpus)
+    {
+        // Codec negotiation: the gateway picks the first codec it can
+        // produce, so Opus leads and WAV stays the universal fallback.
+        Suffix += TEXT(",\"accepted_codecs\":[\"opus\",\"wav\"]");
+    }
+
+    Suffix += TEXT("}");
+
+    CompiledKey = Key;
+    bCompiled = true;
+}
+
+FString FVRSecretaryRequestTemplate::BuildBody(const FString& UserText) const
+{
+    const FString Escaped = FVRSecretaryChatHistory::SerializeStringValue(UserText);
+
+    FString Body;
+    Body.Reserve(Prefix.Len() + Escaped.Len() + Suffix.Len());
+    Body += Prefix;
+    Body += Escaped;
+    Body += Suffix;
+    return Body;
+}
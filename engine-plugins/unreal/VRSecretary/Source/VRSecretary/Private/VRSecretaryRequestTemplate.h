@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Everything a gateway request body depends on besides the user text. The
+ * compiled template is keyed on this; an equality check per send decides
+ * whether recompilation is needed (session or settings changed).
+ */
+struct FVRSecretaryRequestTemplateKey
+{
+    FString SessionId;
+    FString Language;
+    bool bStream = false;
+    bool bPipelineTts = false;
+    bool bBinaryAudioTransport = false;
+    bool bAcceptOpus = false;
+
+    bool operator==(const FVRSecretaryRequestTemplateKey& Other) const
+    {
+        return bStream == Other.bStream &&
+               bPipelineTts == Other.bPipelineTts &&
+               bBinaryAudioTransport == Other.bBinaryAudioTransport &&
+               bAcceptOpus == Other.bAcceptOpus &&
+               SessionId == Other.SessionId &&
+               Language == Other.Language;
+    }
+};
+
+/**
+ * Precompiled /api/vr_chat request body.
+ *
+ * The payload shape is fixed and every field except user_text is constant
+ * for a session, so the body is compiled once into two pre-escaped halves
+ * with the user_text splice point between them. Per send the work is one
+ * escape of the user text and one reserved concatenation — no JSON DOM, no
+ * serializer pass. Companion to FVRSecretaryChatHistory, which does the
+ * same for the DirectOllama prompt.
+ */
+class FVRSecretaryRequestTemplate
+{
+public:
+    /** Compile (or reuse) the template for Key; cheap when Key is unchanged. */
+    void EnsureCompiled(const FVRSecretaryRequestTemplateKey& Key);
+
+    /** Escape UserText and splice it between the precompiled halves. */
+    FString BuildBody(const FString& UserText) const;
+
+private:
+    FVRSecretaryRequestTemplateKey CompiledKey;
+    bool bCompiled = false;
+
+    /** Up to and including `"user_text":`. */
+    FString Prefix;
+
+    /** From `,"language"` through the closing brace. */
+    FString Suffix;
+};
@@ -0,0 +1,105 @@
+#include "VRSecretaryResponseCache.h"
+#include "VRSecretaryLog.h"
+
+FVRSecretaryResponseCache& FVRSecretaryResponseCache::Get()
+{
+    static FVRSecretaryResponseCache Instance;
+    return Instance;
+}
+
+FString FVRSecretaryResponseCache::MakeKey(const FString& UserText, const FString& Language)
+{
+    // Unit separator keeps the fields unambiguous without escaping.
+    return UserText + TEXT("\x1f") + Language;
+}
+
+bool FVRSecretaryResponseCache::Find(const FString& Key, FVRSCachedResponse& OutResponse)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].Key == Key)
+        {
+            OutResponse = Entries[Index].Response;
+            if (Index != 0)
+            {
+                FEntry Entry = MoveTemp(Entries[Index]);
+                Entries.RemoveAt(Index, 1, /*bAllowShrinking=*/false);
+                Entries.Insert(MoveTemp(Entry), 0);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void FVRSecretaryResponseCache::Add(const FString& Key, FVRSCachedResponse&& Response)
+{
+    if (MaxBytes <= 0)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].Key == Key)
+        {
+            UsedBytes -= Entries[Index].Response.GetSizeBytes();
+            Entries.RemoveAt(Index, 1, /*bAllowShrinking=*/false);
+            break;
+        }
+    }
+
+    FEntry Entry;
+    Entry.Key = Key;
+    Entry.Response = MoveTemp(Response);
+    UsedBytes += Entry.Response.GetSizeBytes();
+    Entries.Insert(MoveTemp(Entry), 0);
+
+    EvictOverBudget();
+}
+
+void FVRSecretaryResponseCache::SetAudioData(const FString& Key, const TArray<uint8>& AudioData)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    for (FEntry& Entry : Entries)
+    {
+        if (Entry.Key == Key)
+        {
+            UsedBytes -= Entry.Response.GetSizeBytes();
+            Entry.Response.AudioWavData = AudioData;
+            UsedBytes += Entry.Response.GetSizeBytes();
+            EvictOverBudget();
+            return;
+        }
+    }
+}
+
+void FVRSecretaryResponseCache::SetCapacityBytes(int64 InMaxBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+    MaxBytes = InMaxBytes;
+    EvictOverBudget();
+}
+
+void FVRSecretaryResponseCache::Empty()
+{
+    FScopeLock ScopeLock(&Lock);
+    Entries.Empty();
+    UsedBytes = 0;
+}
+
+void FVRSecretaryResponseCache::EvictOverBudget()
+{
+    while (UsedBytes > MaxBytes && Entries.Num() > 0)
+    {
+        UsedBytes -= Entries.Last().Response.GetSizeBytes();
+        UE_LOG(LogVRSecretary, Verbose, TEXT("Response cache evicting LRU entry (%lld / %lld bytes used)"),
+               UsedBytes, MaxBytes);
+        Entries.Pop(/*bAllowShrinking=*/false);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One cached assistant reply: text plus whichever audio form we received. */
+struct FVRSCachedResponse
+{
+    FString AssistantText;
+
+    /** Inline base64 WAV (base64 transport), empty otherwise. */
+    FString AudioWavBase64;
+
+    /** Raw WAV bytes (binary transport), empty otherwise. */
+    TArray<uint8> AudioWavData;
+
+    int64 GetSizeBytes() const
+    {
+        return (int64)AssistantText.Len() * sizeof(TCHAR)
+             + (int64)AudioWavBase64.Len() * sizeof(TCHAR)
+             + (int64)AudioWavData.Num();
+    }
+};
+
+/**
+ * Process-wide LRU cache of gateway replies, keyed by (user text, language).
+ *
+ * Secretaries repeat themselves constantly — greetings, confirmations,
+ * fillers — and each repeat pays a full LLM + TTS round-trip. SendUserText
+ * consults this cache before SendViaGateway and replays the stored reply
+ * instantly on a hit. Size-bounded (bytes) with least-recently-used
+ * eviction; thread-safe.
+ */
+class FVRSecretaryResponseCache
+{
+public:
+    static FVRSecretaryResponseCache& Get();
+
+    /** Compose the canonical cache key. Voice joins the key once the plugin grows voice selection. */
+    static FString MakeKey(const FString& UserText, const FString& Language);
+
+    /** Look up a reply; on hit copies it out and marks the entry most-recent. */
+    bool Find(const FString& Key, FVRSCachedResponse& OutResponse);
+
+    /** Insert or replace a reply, evicting LRU entries over budget. */
+    void Add(const FString& Key, FVRSCachedResponse&& Response);
+
+    /** Attach late-arriving binary audio to an existing entry (audio_url flow). */
+    void SetAudioData(const FString& Key, const TArray<uint8>& AudioData);
+
+    /** Budget in bytes (from UVRSecretarySettings::ResponseCacheSizeMB); 0 disables. */
+    void SetCapacityBytes(int64 InMaxBytes);
+
+    void Empty();
+
+private:
+    struct FEntry
+    {
+        FString Key;
+        FVRSCachedResponse Response;
+    };
+
+    FCriticalSection Lock;
+
+    /** MRU-first list; entry counts are small (kiosk phrase sets), linear scan is fine. */
+    TArray<FEntry> Entries;
+
+    int64 MaxBytes = 32 * 1024 * 1024;
+    int64 UsedBytes = 0;
+
+    void EvictOverBudget();
+};
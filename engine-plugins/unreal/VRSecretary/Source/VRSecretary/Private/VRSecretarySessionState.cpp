@@ -0,0 +1,30 @@
+#include "VRSecretarySessionState.h"
+#include "VRSecretaryLog.h"
+
+void UVRSecretarySessionState::Store(const FString& Key, FVRSecretarySessionSnapshot&& Snapshot)
+{
+    if (Key.IsEmpty())
+    {
+        return;
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("Parking session state for \"%s\" (%d history bytes)"),
+           *Key, Snapshot.HistoryBlob.Num());
+    Snapshots.Add(Key, MoveTemp(Snapshot));
+}
+
+bool UVRSecretarySessionState::Restore(const FString& Key, FVRSecretarySessionSnapshot& OutSnapshot) const
+{
+    const FVRSecretarySessionSnapshot* Found = Snapshots.Find(Key);
+    if (!Found)
+    {
+        return false;
+    }
+    OutSnapshot = *Found;
+    return true;
+}
+
+void UVRSecretarySessionState::Discard(const FString& Key)
+{
+    Snapshots.Remove(Key);
+}
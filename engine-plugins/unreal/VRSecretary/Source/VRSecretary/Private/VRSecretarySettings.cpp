@@ -12,8 +12,21 @@ UVRSecretarySettings::UVRSecretarySettings()
     GatewayUrl          = TEXT("http://localhost:8000");
     DefaultLanguageCode = TEXT("en");               // Default to English
     HttpTimeout         = 60.0f;
+    MaxConcurrentGatewayRequests = 4;
+    bPrewarmGatewayConnection = true;
+    PrewarmMaxJitterSeconds   = 2.0f;
+    MaxGatewayRetries         = 2;
+    GatewayRetryBackoffSeconds = 0.5f;
+    bHedgeGatewayRequests     = false;
+    HedgeThresholdSeconds     = 0.75f;
+    ResponseCacheSizeMB = 32;
+    DiskAudioCacheSizeMB = 64;
     DirectOllamaUrl     = TEXT("http://localhost:11434");
     DirectOllamaModel   = TEXT("llama3");
+    DirectOllamaMaxHistoryTurns    = 16;
+    DirectOllamaHistoryTokenBudget = 2048;
+    LocalLlamaContextSize = 4096;
+    LocalLlamaThreads     = 0;                      // 0 = auto
 
     UE_LOG(
         LogVRSecretary,
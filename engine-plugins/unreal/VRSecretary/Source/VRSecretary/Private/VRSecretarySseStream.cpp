@@ -0,0 +1,149 @@
+#include "VRSecretarySseStream.h"
+#include "VRSecretaryLog.h"
+
+#include "Json.h"
+
+FVRSecretarySseStream::FVRSecretarySseStream()
+    : bReceivedFinalFrame(false)
+{
+    SetIsSaving(true);
+}
+
+void FVRSecretarySseStream::Serialize(void* V, int64 Length)
+{
+    if (!V || Length <= 0 || bReceivedFinalFrame)
+    {
+        return;
+    }
+
+    PendingBytes.Append(static_cast<const uint8*>(V), static_cast<int32>(Length));
+    DrainCompleteFrames();
+}
+
+FString FVRSecretarySseStream::GetUnconsumedBodyAsString() const
+{
+    if (PendingBytes.Num() == 0)
+    {
+        return FString();
+    }
+
+    const FUTF8ToTCHAR Converter(
+        reinterpret_cast<const ANSICHAR*>(PendingBytes.GetData()),
+        PendingBytes.Num());
+    return FString(Converter.Length(), Converter.Get());
+}
+
+void FVRSecretarySseStream::DrainCompleteFrames()
+{
+    // Frames are separated by a blank line ("\n\n"); scan for the separator
+    // and only consume bytes that form a complete frame. Partial frames stay
+    // in PendingBytes until the next Serialize call.
+    int32 FrameStart = 0;
+
+    for (int32 Index = 0; Index + 1 < PendingBytes.Num(); ++Index)
+    {
+        if (PendingBytes[Index] != '\n' || PendingBytes[Index + 1] != '\n')
+        {
+            continue;
+        }
+
+        const int32 FrameLen = Index - FrameStart;
+        if (FrameLen > 0)
+        {
+            FString Frame;
+            {
+                const FUTF8ToTCHAR Converter(
+                    reinterpret_cast<const ANSICHAR*>(PendingBytes.GetData() + FrameStart),
+                    FrameLen);
+                Frame = FString(Converter.Length(), Converter.Get());
+            }
+
+            // A frame may contain several "data:" lines plus comments; we only
+            // care about data lines.
+            TArray<FString> Lines;
+            Frame.ParseIntoArrayLines(Lines);
+            for (const FString& Line : Lines)
+            {
+                if (Line.StartsWith(TEXT("data:")))
+                {
+                    HandleFramePayload(Line.Mid(5).TrimStartAndEnd());
+                }
+            }
+        }
+
+        FrameStart = Index + 2;
+        ++Index; // Skip the second '\n'
+    }
+
+    if (FrameStart > 0)
+    {
+        PendingBytes.RemoveAt(0, FrameStart, /*bAllowShrinking=*/false);
+    }
+}
+
+void FVRSecretarySseStream::HandleFramePayload(const FString& Payload)
+{
+    if (Payload.IsEmpty() || Payload == TEXT("[DONE]"))
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Payload);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogVRSecretary, Warning, TEXT("SSE stream: skipping unparsable frame"));
+        return;
+    }
+
+    bool bDone = false;
+    JsonObject->TryGetBoolField(TEXT("done"), bDone);
+
+    if (bDone)
+    {
+        bReceivedFinalFrame = true;
+
+        FString AssistantText;
+        FString AudioBase64;
+        FString AudioUrl;
+        if (!JsonObject->TryGetStringField(TEXT("assistant_text"), AssistantText))
+        {
+            // Gateways may omit the full text in the final frame; fall back to
+            // what we accumulated from the deltas.
+            AssistantText = AccumulatedText;
+        }
+        JsonObject->TryGetStringField(TEXT("audio_wav_base64"), AudioBase64);
+        JsonObject->TryGetStringField(TEXT("audio_url"), AudioUrl);
+
+        if (OnFinalFrame)
+        {
+            OnFinalFrame(AssistantText, AudioBase64, AudioUrl);
+        }
+        return;
+    }
+
+    int32 SegmentIndex = INDEX_NONE;
+    if (JsonObject->TryGetNumberField(TEXT("segment"), SegmentIndex))
+    {
+        bool bLast = false;
+        JsonObject->TryGetBoolField(TEXT("last"), bLast);
+        FString AudioBase64;
+        JsonObject->TryGetStringField(TEXT("audio_wav_base64"), AudioBase64);
+
+        if (OnAudioSegment)
+        {
+            OnAudioSegment(SegmentIndex, bLast, AudioBase64);
+        }
+        return;
+    }
+
+    FString Delta;
+    if (JsonObject->TryGetStringField(TEXT("delta"), Delta) && !Delta.IsEmpty())
+    {
+        AccumulatedText += Delta;
+        if (OnTextDelta)
+        {
+            OnTextDelta(Delta, AccumulatedText);
+        }
+    }
+}
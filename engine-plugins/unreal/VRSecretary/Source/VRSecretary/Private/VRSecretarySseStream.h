@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+
+/**
+ * Incremental reader for Server-Sent Events (SSE) bodies produced by the
+ * gateway's streaming /api/vr_chat mode.
+ *
+ * Plugged into IHttpRequest::SetResponseBodyReceiveStream so that frames are
+ * parsed as they arrive instead of waiting for the full response. Serialize()
+ * is called on the HTTP thread; the reader accumulates bytes, cuts complete
+ * "data: {...}\n\n" frames, and invokes the callbacks below. Callers are
+ * responsible for marshalling back to the game thread (the component does
+ * this via AsyncTask).
+ *
+ * Expected frame payloads:
+ *   { "delta": "<text fragment>" }
+ *   { "segment": n, "last": bool, "audio_wav_base64": "..." }   (pipelined TTS)
+ *   { "done": true, "assistant_text": "...", "audio_wav_base64": "..." }
+ */
+class FVRSecretarySseStream : public FArchive
+{
+public:
+    /** Invoked per text fragment: (Delta, AccumulatedText). */
+    TFunction<void(const FString&, const FString&)> OnTextDelta;
+
+    /** Invoked per pipelined audio segment: (SegmentIndex, bLast, AudioBase64). */
+    TFunction<void(int32, bool, const FString&)> OnAudioSegment;
+
+    /** Invoked once for the final frame: (AssistantText, AudioWavBase64, AudioUrl). */
+    TFunction<void(const FString&, const FString&, const FString&)> OnFinalFrame;
+
+    FVRSecretarySseStream();
+
+    // FArchive interface
+    virtual void Serialize(void* V, int64 Length) override;
+    virtual FString GetArchiveName() const override { return TEXT("FVRSecretarySseStream"); }
+
+    /** True once a "done" frame has been consumed. */
+    bool ReceivedFinalFrame() const { return bReceivedFinalFrame; }
+
+    /** Everything streamed so far (accumulated deltas). */
+    const FString& GetAccumulatedText() const { return AccumulatedText; }
+
+    /**
+     * Unconsumed raw bytes as a string. When a gateway does not support SSE
+     * it answers with a plain JSON body, which lands here untouched; the
+     * component uses this to fall back to non-streaming parsing.
+     */
+    FString GetUnconsumedBodyAsString() const;
+
+private:
+    /** Raw UTF-8 bytes not yet cut into complete frames. */
+    TArray<uint8> PendingBytes;
+
+    FString AccumulatedText;
+    bool bReceivedFinalFrame;
+
+    /** Cut and dispatch every complete frame in PendingBytes. */
+    void DrainCompleteFrames();
+
+    /** Parse one JSON frame payload (the part after "data: "). */
+    void HandleFramePayload(const FString& Payload);
+};
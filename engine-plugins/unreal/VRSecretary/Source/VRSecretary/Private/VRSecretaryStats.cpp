@@ -0,0 +1,9 @@
+#include "VRSecretaryStats.h"
+
+DEFINE_STAT(STAT_VRSecretary_RequestSerialize);
+DEFINE_STAT(STAT_VRSecretary_JsonParse);
+DEFINE_STAT(STAT_VRSecretary_MicFrameProcess);
+DEFINE_STAT(STAT_VRSecretary_NetworkTimeMs);
+DEFINE_STAT(STAT_VRSecretary_TimeToFirstAudioMs);
+
+CSV_DEFINE_CATEGORY_MODULE(VRSECRETARY_API, VRSecretary, true);
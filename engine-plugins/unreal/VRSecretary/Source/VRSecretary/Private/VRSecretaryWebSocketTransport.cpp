@@ -0,0 +1,202 @@
+#include "VRSecretaryWebSocketTransport.h"
+#include "VRSecretaryLog.h"
+
+#include "IWebSocket.h"
+#include "WebSocketsModule.h"
+
+FVRSecretaryWebSocketTransport::~FVRSecretaryWebSocketTransport()
+{
+    Close();
+}
+
+void FVRSecretaryWebSocketTransport::Configure(const FString& InUrl)
+{
+    if (Url == InUrl)
+    {
+        return;
+    }
+
+    Url = InUrl;
+
+    // Drop any socket pointed at the old endpoint; the next send reconnects.
+    if (Socket.IsValid())
+    {
+        Socket->Close();
+        Socket.Reset();
+    }
+    CancelReconnect();
+    ReconnectAttempts = 0;
+}
+
+void FVRSecretaryWebSocketTransport::SendMessage(const FString& Json)
+{
+    bClosing = false;
+
+    if (Socket.IsValid() && Socket->IsConnected())
+    {
+        Socket->Send(Json);
+        return;
+    }
+
+    PendingMessages.Add(Json);
+    ReconnectAttempts = 0; // Fresh demand gets a fresh reconnect budget.
+    EnsureConnected();
+}
+
+void FVRSecretaryWebSocketTransport::SendBinary(const void* Data, SIZE_T Size)
+{
+    if (Socket.IsValid() && Socket->IsConnected())
+    {
+        Socket->Send(Data, Size, /*bIsBinary=*/true);
+    }
+}
+
+void FVRSecretaryWebSocketTransport::Close()
+{
+    bClosing = true;
+    CancelReconnect();
+    PendingMessages.Reset();
+
+    if (Socket.IsValid())
+    {
+        Socket->Close();
+        Socket.Reset();
+    }
+}
+
+bool FVRSecretaryWebSocketTransport::IsConnected() const
+{
+    return Socket.IsValid() && Socket->IsConnected();
+}
+
+void FVRSecretaryWebSocketTransport::EnsureConnected()
+{
+    if (Url.IsEmpty() || (Socket.IsValid() && Socket->IsConnected()))
+    {
+        return;
+    }
+
+    if (!Socket.IsValid())
+    {
+        Socket = FWebSocketsModule::Get().CreateWebSocket(Url);
+
+        TWeakPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> WeakThis(AsShared());
+
+        Socket->OnConnected().AddLambda([WeakThis]()
+        {
+            if (TSharedPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                This->HandleConnected();
+            }
+        });
+
+        Socket->OnConnectionError().AddLambda([WeakThis](const FString& Error)
+        {
+            if (TSharedPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                This->HandleConnectionLost(Error);
+            }
+        });
+
+        Socket->OnClosed().AddLambda([WeakThis](int32 StatusCode, const FString& Reason, bool bWasClean)
+        {
+            if (TSharedPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                This->HandleConnectionLost(FString::Printf(TEXT("closed (%d): %s"), StatusCode, *Reason));
+            }
+        });
+
+        Socket->OnMessage().AddLambda([WeakThis](const FString& Message)
+        {
+            if (TSharedPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                if (This->OnMessage)
+                {
+                    This->OnMessage(Message);
+                }
+            }
+        });
+    }
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("WebSocket connecting to %s"), *Url);
+    Socket->Connect();
+}
+
+void FVRSecretaryWebSocketTransport::HandleConnected()
+{
+    UE_LOG(LogVRSecretary, Log, TEXT("WebSocket connected to %s"), *Url);
+    ReconnectAttempts = 0;
+
+    TArray<FString> ToSend = MoveTemp(PendingMessages);
+    PendingMessages.Reset();
+    for (const FString& Message : ToSend)
+    {
+        Socket->Send(Message);
+    }
+}
+
+void FVRSecretaryWebSocketTransport::HandleConnectionLost(const FString& Reason)
+{
+    if (bClosing)
+    {
+        return;
+    }
+
+    UE_LOG(LogVRSecretary, Warning, TEXT("WebSocket connection lost: %s"), *Reason);
+
+    // The old socket object cannot be reused after a failure; rebuild on retry.
+    if (Socket.IsValid())
+    {
+        Socket.Reset();
+    }
+
+    if (ReconnectAttempts < MaxReconnectAttempts)
+    {
+        ScheduleReconnect();
+        return;
+    }
+
+    // Budget spent: surface the failure for whatever was queued and go idle
+    // until the next send asks for a connection again.
+    PendingMessages.Reset();
+    if (OnError)
+    {
+        OnError(FString::Printf(TEXT("WebSocket connection failed: %s"), *Reason));
+    }
+}
+
+void FVRSecretaryWebSocketTransport::ScheduleReconnect()
+{
+    if (ReconnectHandle.IsValid())
+    {
+        return; // Already pending.
+    }
+
+    const float DelaySeconds = FMath::Min(30.0f, (float)(1 << ReconnectAttempts));
+    ++ReconnectAttempts;
+
+    UE_LOG(LogVRSecretary, Verbose, TEXT("WebSocket reconnect attempt %d in %.0f s"),
+           ReconnectAttempts, DelaySeconds);
+
+    TWeakPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> WeakThis(AsShared());
+    ReconnectHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateLambda([WeakThis](float)
+        {
+            if (TSharedPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                This->ReconnectHandle.Reset();
+                This->EnsureConnected();
+            }
+            return false; // One-shot.
+        }),
+        DelaySeconds);
+}
+
+void FVRSecretaryWebSocketTransport::CancelReconnect()
+{
+    if (ReconnectHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ReconnectHandle);
+        ReconnectHandle.Reset();
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class IWebSocket;
+
+/**
+ * Persistent WebSocket channel to the gateway (GatewayWebSocket mode).
+ *
+ * A per-request HTTP POST pays TCP+TLS setup on every utterance (80-150 ms
+ * against a remote gateway, worse on Quest Wi-Fi). This transport keeps one
+ * full-duplex connection open for the whole session: chat requests go out as
+ * JSON text frames, replies come back as the same delta/done frames the SSE
+ * path uses.
+ *
+ * Connects lazily on first send, queues frames while connecting, and
+ * reconnects with exponential backoff when the link drops. The IWebSocket
+ * callbacks (and therefore OnMessage/OnError) fire on the game thread.
+ */
+class FVRSecretaryWebSocketTransport : public TSharedFromThis<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe>
+{
+public:
+    ~FVRSecretaryWebSocketTransport();
+
+    /** Set the ws:// or wss:// endpoint. A URL change drops the old socket. */
+    void Configure(const FString& InUrl);
+
+    /** Queue one JSON text frame, connecting (or reconnecting) on demand. */
+    void SendMessage(const FString& Json);
+
+    /**
+     * Send one binary frame if the connection is up, else drop it. Binary
+     * frames carry live audio for the STT uplink: by the time a reconnect
+     * lands they describe silence long past, so unlike JSON control frames
+     * they are never queued.
+     */
+    void SendBinary(const void* Data, SIZE_T Size);
+
+    /** Open the connection eagerly (prewarm); no-op when already connected. */
+    void EnsureConnected();
+
+    /** Close the connection and stop reconnecting. */
+    void Close();
+
+    bool IsConnected() const;
+
+    /** One gateway JSON frame (delta/done/error payload). */
+    TFunction<void(const FString& Message)> OnMessage;
+
+    /** Connection failure after the reconnect budget is exhausted. */
+    TFunction<void(const FString& Error)> OnError;
+
+private:
+    void HandleConnected();
+    void HandleConnectionLost(const FString& Reason);
+    void ScheduleReconnect();
+    void CancelReconnect();
+
+    /** Give up after this many consecutive failed connection attempts. */
+    static constexpr int32 MaxReconnectAttempts = 6;
+
+    FString Url;
+    TSharedPtr<IWebSocket> Socket;
+
+    /** Frames waiting for the connection to come up. */
+    TArray<FString> PendingMessages;
+
+    int32 ReconnectAttempts = 0;
+    FTSTicker::FDelegateHandle ReconnectHandle;
+    bool bClosing = false;
+};
@@ -16,8 +16,52 @@ enum class EVRSecretaryBackendMode : uint8
     /** Call Ollama’s OpenAI-compatible HTTP API directly from Unreal */
     DirectOllama     UMETA(DisplayName = "Direct Ollama (HTTP)"),
 
-    /** Placeholder for a future native llama.cpp integration */
-    LocalLlamaCpp    UMETA(DisplayName = "Local Llama.cpp (stub)")
+    /** Native llama.cpp inference on a worker thread (needs ThirdParty/LlamaCpp) */
+    LocalLlamaCpp    UMETA(DisplayName = "Local Llama.cpp"),
+
+    /**
+     * Persistent full-duplex WebSocket to the gateway: one connection per
+     * session instead of a TCP+TLS handshake per utterance. Same delegates,
+     * automatic reconnect.
+     */
+    GatewayWebSocket UMETA(DisplayName = "Gateway (WebSocket)")
+};
+
+/**
+ * Measured quality of the link to the backend, derived from per-request
+ * round-trip times, payload throughput and failure rate. Drives the
+ * adaptive quality controller (bAdaptiveQuality) and is readable from
+ * Blueprints for UI/telemetry.
+ */
+UENUM(BlueprintType)
+enum class EVRSecretaryNetworkTier : uint8
+{
+    /** Not enough samples yet; no adaptation is applied. */
+    Unknown   UMETA(DisplayName = "Unknown"),
+
+    /** Fast and reliable (LAN-class); configured settings are used as-is. */
+    Good      UMETA(DisplayName = "Good"),
+
+    /** Constrained bandwidth or elevated failures; compressed audio preferred. */
+    Degraded  UMETA(DisplayName = "Degraded"),
+
+    /** Slow or lossy (congested venue Wi-Fi); full adaptation engaged. */
+    Poor      UMETA(DisplayName = "Poor")
+};
+
+/** What happens to an in-flight request when a new utterance is sent. */
+UENUM(BlueprintType)
+enum class EVRSecretaryPendingRequestPolicy : uint8
+{
+    /**
+     * Abort the in-flight request; only the newest utterance is answered.
+     * Saves gateway compute on answers nobody will hear and prevents stale
+     * responses racing into OnAssistantResponse.
+     */
+    CancelPrevious   UMETA(DisplayName = "Cancel Previous"),
+
+    /** Let requests run in parallel (responses may arrive out of order). */
+    AllowParallel    UMETA(DisplayName = "Allow Parallel")
 };
 
 /** Generic sampling config passed to the backends. */
@@ -46,6 +90,44 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     const FString&, AudioWavBase64
 );
 
+/**
+ * Fired for each partial chunk of assistant text while a streaming reply is
+ * in flight (Gateway modes with bStreamResponses enabled). TextDelta is the
+ * newly received fragment; AccumulatedText is everything received so far.
+ * OnAssistantResponse still fires once at the end with the complete reply.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+    FVRSecretaryOnAssistantTextDelta,
+    const FString&, TextDelta,
+    const FString&, AccumulatedText
+);
+
+/**
+ * Fired when raw WAV bytes arrive through the binary audio transport
+ * (bUseBinaryAudioTransport): the gateway returns a short-lived audio_url
+ * instead of base64, the component downloads it and broadcasts the bytes
+ * here — no base64 round-trip, ready to hand to an audio decoder.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
+    FVRSecretaryOnAssistantAudio,
+    const TArray<uint8>&, AudioWavData
+);
+
+/**
+ * Fired per audio segment of a pipelined-TTS reply (bPipelineTtsAudio): the
+ * gateway splits the reply into sentences, synthesizes them in parallel and
+ * delivers the audio in order. Segments arrive in SegmentIndex order; bLast
+ * marks the final one. Hand them to a segmented playback stream for gap-free
+ * stitching. OnAssistantResponse still fires once at the end (audio empty —
+ * it was already delivered here).
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
+    FVRSecretaryOnAssistantAudioSegment,
+    int32, SegmentIndex,
+    bool, bLast,
+    const FString&, AudioWavBase64
+);
+
 /** Fired when something goes wrong (HTTP failure, JSON error, etc.). */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
     FVRSecretaryOnError,
@@ -21,6 +21,9 @@ class VRSECRETARY_API UVRSecretaryComponent : public UActorComponent
 public:
     UVRSecretaryComponent();
 
+    /** Out-of-line so TUniquePtr members can use forward-declared types. */
+    virtual ~UVRSecretaryComponent() override;
+
     /** Optional per-component override of the backend mode. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary")
     EVRSecretaryBackendMode BackendModeOverride;
@@ -40,34 +43,520 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary")
     FString SessionId;
 
+    /**
+     * If true, session state — session id plus the DirectOllama history
+     * window — is parked in the game instance at EndPlay and rehydrated at
+     * BeginPlay, so level travel doesn't restart the conversation cold. The
+     * gateway needs no re-handshake (session identity rides every request);
+     * the usual prewarm brings the connection back up. Keyed by
+     * SessionPersistenceKey.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Persist Session Across Travel"
+    ))
+    bool bPersistSessionAcrossTravel = true;
+
+    /**
+     * Stable identity for the travel handover. Empty uses the owning
+     * actor's name, which is stable for level-placed actors; set this
+     * explicitly for spawned actors whose names vary per load.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary")
+    FString SessionPersistenceKey;
+
+    /**
+     * If true, Gateway requests ask for a streamed (SSE) reply and partial
+     * text is broadcast through OnAssistantTextDelta as tokens arrive.
+     * OnAssistantResponse still fires once with the complete reply, so
+     * existing Blueprints keep working. Gateways without streaming support
+     * fall back to a single non-streamed response transparently.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Stream Responses",
+        ToolTip="Request streamed (SSE) replies from the gateway and broadcast partial text via OnAssistantTextDelta."
+    ))
+    bool bStreamResponses = false;
+
+    /**
+     * If true, Gateway requests negotiate binary audio delivery: the JSON
+     * reply carries a short-lived audio_url instead of audio_wav_base64, the
+     * component downloads the raw WAV and broadcasts it through
+     * OnAssistantAudioReady. Saves the ~33% base64 wire overhead and the
+     * decode pass. OnAssistantResponse then fires with an empty base64 string.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Binary Audio Transport",
+        ToolTip="Fetch TTS audio as raw WAV bytes via a short-lived URL instead of inline base64."
+    ))
+    bool bUseBinaryAudioTransport = false;
+
+    /**
+     * If true, Gateway requests advertise Opus in accepted_codecs so the
+     * gateway may ship compressed Ogg Opus audio instead of PCM WAV (~10x
+     * fewer bytes at the same voice quality). Only enable when the consumer
+     * decodes via a codec-agnostic path (e.g. the sample game's
+     * DecodeAudioBytesToSoundWave); gateways without Opus keep sending WAV.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Accept Opus Audio"
+    ))
+    bool bAcceptOpusAudio = false;
+
+    /**
+     * If true, Gateway replies are cached by (user text, language) and
+     * repeated phrases — greetings, confirmations, fillers — are answered
+     * instantly from the cache instead of paying another LLM + TTS round
+     * trip. Budget lives in UVRSecretarySettings::ResponseCacheSizeMB.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Enable Response Cache"
+    ))
+    bool bEnableResponseCache = true;
+
+    /**
+     * If true, streamed Gateway replies (bStreamResponses or the WebSocket
+     * mode) pipeline TTS at sentence granularity: the gateway synthesizes
+     * sentences in parallel and ships each as an ordered audio segment via
+     * OnAssistantAudioSegment, so a 30-second answer starts playing after
+     * the first sentence instead of after the whole synthesis pass. Pair
+     * with a segmented playback stream for gap-free stitching. Pipelined
+     * replies are not entered into the response cache (their audio never
+     * arrives as one unit).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Pipeline TTS Audio"
+    ))
+    bool bPipelineTtsAudio = false;
+
+    /**
+     * If true, chat reply completions (gateway and DirectOllama) are
+     * delivered on the HTTP thread and the heavy work — JSON parsing, field
+     * extraction, base64 audio decode — happens there; only the finished
+     * lightweight result returns to the game thread for bookkeeping and
+     * delegate broadcast. Keeps multi-megabyte reply bodies from competing
+     * with rendering for game-thread time. Streamed (SSE) replies already
+     * parse incrementally on the HTTP thread and are unaffected.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Process Responses Off Game Thread"
+    ))
+    bool bProcessResponsesOffGameThread = false;
+
+    /**
+     * If true, the component adapts to measured network conditions instead
+     * of running every venue on the same static config: timeouts and the
+     * hedge threshold track observed completion times, and on a Degraded or
+     * Poor link (see EVRSecretaryNetworkTier) it advertises Opus audio,
+     * switches to streamed replies and shrinks the DirectOllama history
+     * budget. Adaptation only upgrades the explicit settings — a manually
+     * enabled option is never turned off. The Opus adaptation requires a
+     * codec-agnostic consumer, same as bAcceptOpusAudio.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary", meta=(
+        DisplayName="Adaptive Quality"
+    ))
+    bool bAdaptiveQuality = false;
+
     /** Fired when a response (text + optional audio) is received. */
     UPROPERTY(BlueprintAssignable, Category="VRSecretary")
     FVRSecretaryOnAssistantResponse OnAssistantResponse;
 
+    /** Fired per ordered audio segment of a pipelined-TTS reply. */
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary")
+    FVRSecretaryOnAssistantAudioSegment OnAssistantAudioSegment;
+
+    /** Fired per partial text chunk while a streamed reply is in flight. */
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary")
+    FVRSecretaryOnAssistantTextDelta OnAssistantTextDelta;
+
+    /** Fired with raw WAV bytes when using the binary audio transport. */
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary")
+    FVRSecretaryOnAssistantAudio OnAssistantAudioReady;
+
     /** Fired when an error occurs. */
     UPROPERTY(BlueprintAssignable, Category="VRSecretary")
     FVRSecretaryOnError OnError;
 
+    /**
+     * Dispatch priority when the request scheduler is saturated: higher
+     * values go to the gateway sooner. Raise this on the NPC the player is
+     * facing so background chatter can't starve it.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary")
+    int32 RequestPriority = 0;
+
+    /**
+     * How to treat an in-flight request when SendUserText is called again
+     * before the reply arrived. Defaults to CancelPrevious: a user speaking
+     * over a slow reply aborts the stale request instead of racing it.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary")
+    EVRSecretaryPendingRequestPolicy PendingRequestPolicy = EVRSecretaryPendingRequestPolicy::CancelPrevious;
+
     /**
      * Send user text to the configured backend.
      * Returns immediately; result is delivered via delegates.
+     *
+     * @return A handle identifying the in-flight HTTP request (can be used
+     *         to correlate cancellations), or -1 when no cancellable request
+     *         was started (validation failure or local inference).
+     */
+    UFUNCTION(BlueprintCallable, Category="VRSecretary")
+    int32 SendUserText(const FString& UserText, const FVRSecretaryChatConfig& Config);
+
+    /**
+     * Speculatively run the full gateway + TTS pipeline for a line the
+     * player is likely to trigger next (menu confirmations, scripted beats)
+     * and park the reply in the response cache, so the eventual SendUserText
+     * resolves instantly from cache. Fires no response delegates.
+     *
+     * Prefetches ride the request scheduler's background lane: they queue
+     * behind all interactive traffic and never take its last concurrency
+     * slot. They also survive CancelPendingRequests and new utterances —
+     * only EndPlay aborts them. Always issued as a plain (non-streamed)
+     * gateway POST, including in the WebSocket and streaming modes, since
+     * the cache stores whole replies. Requires the response cache; Config
+     * is reserved for the direct backends and ignored by the gateway, as in
+     * SendUserText.
+     *
+     * @return True when a prefetch was started (or a disk-cached reply was
+     *         promoted to RAM); false when already cached, disabled, or not
+     *         in a gateway mode.
      */
     UFUNCTION(BlueprintCallable, Category="VRSecretary")
-    void SendUserText(const FString& UserText, const FVRSecretaryChatConfig& Config);
+    bool PrefetchResponse(const FString& UserText, const FVRSecretaryChatConfig& Config);
+
+    /**
+     * Abort every in-flight HTTP request of this component (chat and audio
+     * downloads). Cancelled requests complete silently: no OnError, no
+     * OnAssistantResponse. Background prefetches are left running.
+     */
+    UFUNCTION(BlueprintCallable, Category="VRSecretary")
+    void CancelPendingRequests();
+
+    /** Number of requests currently in flight. */
+    UFUNCTION(BlueprintPure, Category="VRSecretary")
+    int32 GetNumPendingRequests() const { return InFlightRequests.Num(); }
+
+    /**
+     * Measured quality of the link to the backend (process-wide), as
+     * classified by the adaptive quality controller. Unknown until enough
+     * requests have completed; useful for connection-quality UI.
+     */
+    UFUNCTION(BlueprintPure, Category="VRSecretary")
+    EVRSecretaryNetworkTier GetNetworkTier() const;
+
+    /**
+     * Snapshot the session into the game instance now, without waiting for
+     * EndPlay — e.g. right before a manual travel. No-op when persistence
+     * is disabled or no key resolves.
+     */
+    UFUNCTION(BlueprintCallable, Category="VRSecretary")
+    void SaveSessionState();
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
     const UVRSecretarySettings* Settings;
 
+    /** SSE reader kept alive for the in-flight streaming request, if any. */
+    TSharedPtr<class FVRSecretarySseStream, ESPMode::ThreadSafe> ActiveSseStream;
+
+    /** Persistent connection for GatewayWebSocket mode (lazily created). */
+    TSharedPtr<class FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> WsTransport;
+
+    /** Bookkeeping for the utterance currently served over the WebSocket. */
+    double WsUtteranceStartSeconds = 0.0;
+    FString WsCacheKey;
+    FString WsAccumulatedText;
+
+    /** Rolling conversation window for DirectOllama mode (lazily created). */
+    TUniquePtr<class FVRSecretaryChatHistory> DirectHistory;
+
+    /**
+     * Precompiled gateway request body (lazily created); recompiles only
+     * when the session or payload-shaping settings change, so per send the
+     * serialization cost is escaping the user text plus one concatenation.
+     */
+    TUniquePtr<class FVRSecretaryRequestTemplate> GatewayRequestTemplate;
+
+    /**
+     * Separate template for prefetch bodies, which always use the
+     * non-streamed payload shape; sharing GatewayRequestTemplate would
+     * recompile it on every prefetch/send alternation in streaming modes.
+     */
+    TUniquePtr<class FVRSecretaryRequestTemplate> PrefetchRequestTemplate;
+
+    /** User text awaiting its assistant reply before joining DirectHistory. */
+    FString PendingDirectUserText;
+
+    /** One tracked in-flight HTTP request. */
+    struct FInFlightRequest
+    {
+        int32 Handle = INDEX_NONE;
+        FHttpRequestPtr Request;
+
+        /** Response-cache key this request populates on success (empty = uncached). */
+        FString CacheKey;
+
+        /** When this HTTP request was dispatched (FPlatformTime::Seconds). */
+        double StartTimeSeconds = 0.0;
+
+        /**
+         * When the user interaction behind this request started. Equals
+         * StartTimeSeconds for chat requests; audio downloads inherit the
+         * originating chat request's value so time-to-first-audio spans the
+         * whole round trip.
+         */
+        double UtteranceStartSeconds = 0.0;
+
+        /**
+         * False while the request sits in the scheduler queue. Undispatched
+         * requests never get a completion callback, so cancellation just
+         * drops them instead of routing them through CancelledRequests.
+         */
+        bool bDispatched = true;
+
+        /**
+         * Serialized chat body kept for re-dispatch on retry or hedge.
+         * Empty for requests that don't retry (audio downloads, SSE).
+         */
+        FString RetryBody;
+
+        /** Zero-based retry attempt of this chat request. */
+        int32 AttemptIndex = 0;
+
+        /** Which gateway replica URL this attempt targets (rotating index). */
+        int32 UrlIndex = 0;
+
+        /**
+         * Links hedged sibling attempts racing for the same utterance
+         * (the first leg's handle), or INDEX_NONE when not hedged.
+         */
+        int32 HedgeGroup = INDEX_NONE;
+    };
+
+    /** Source for request handles (per component, monotonically increasing). */
+    int32 NextRequestHandle = 1;
+
+    /** Requests awaiting completion. */
+    TArray<FInFlightRequest> InFlightRequests;
+
+    /** Requests we aborted; their completions are swallowed silently. */
+    TArray<FHttpRequestPtr> CancelledRequests;
+
+    /** One tracked background prefetch request (chat or audio download). */
+    struct FPrefetchRequest
+    {
+        FHttpRequestPtr Request;
+
+        /** False while the request waits in the scheduler's prefetch lane. */
+        bool bDispatched = true;
+    };
+
+    /**
+     * Background prefetch requests, tracked apart from InFlightRequests so
+     * interactive bookkeeping — pending-count, CancelPrevious, retries,
+     * hedging — never sees them. Cleared at EndPlay; a completion no longer
+     * in this list is a cancelled one and is dropped.
+     */
+    TArray<FPrefetchRequest> PrefetchRequests;
+
+    /** Find a prefetch bookkeeping entry, or null when gone. */
+    FPrefetchRequest* FindPrefetch(const FHttpRequestPtr& Request);
+
+    /** Register and (via the scheduler's prefetch lane) dispatch a prefetch. */
+    void TrackAndDispatchPrefetch(const FHttpRequestPtr& Request);
+
+    /**
+     * Register a request and hand out its handle. Pass UtteranceStartSeconds
+     * for follow-up requests (audio downloads) so stats attribute them to the
+     * originating utterance; negative means "starts now".
+     */
+    int32 TrackRequest(const FHttpRequestPtr& Request, const FString& CacheKey = FString(),
+                       double UtteranceStartSeconds = -1.0);
+
+    /**
+     * Remove a completed request from the books. Returns true when the
+     * request had been cancelled and its completion must be ignored;
+     * otherwise optionally hands back the bookkeeping entry.
+     */
+    bool FinishRequest(const FHttpRequestPtr& Request, FInFlightRequest* OutInFlight = nullptr);
+
     void EnsureSessionId();
     FString GetEffectiveLanguageCode() const;
 
-    void SendViaGateway(const FString& UserText);
-    void SendViaDirectOllama(const FString& UserText, const FVRSecretaryChatConfig& Config);
-    void SendViaLocalLlamaCpp(const FString& UserText, const FVRSecretaryChatConfig& Config);
+    /** Project-level backend mode unless this component overrides it. */
+    EVRSecretaryBackendMode GetEffectiveBackendMode() const;
+
+    /** The game instance's request scheduler, or null outside a game world. */
+    class UVRSecretaryRequestScheduler* GetScheduler() const;
+
+    /** The game instance's session parking lot, or null outside a game world. */
+    class UVRSecretarySessionState* GetSessionState() const;
+
+    /** Settings->HttpTimeout, extended by the adaptive controller when enabled. */
+    float GetEffectiveHttpTimeout() const;
+
+    /** Settings->HedgeThresholdSeconds, tightened by the adaptive controller when enabled. */
+    float GetEffectiveHedgeThresholdSeconds() const;
+
+    /** SessionPersistenceKey, or the owning actor's name when unset. */
+    FString GetEffectivePersistenceKey() const;
+
+    /**
+     * Rehydrate a parked session at BeginPlay: adopt its session id and
+     * rebuild the DirectOllama history window. Returns false when there was
+     * nothing to restore.
+     */
+    bool TryRestoreSessionState();
+
+    /** Find the bookkeeping entry for a handle, or null when gone. */
+    FInFlightRequest* FindInFlightByHandle(int32 Handle);
+
+    /** Lazily create (and point at the current gateway URL) the WS transport. */
+    class FVRSecretaryWebSocketTransport& GetOrCreateWsTransport();
+
+    /**
+     * Warm up the transport before the first utterance: GET /health for the
+     * HTTP gateway modes, socket connect for WebSocket mode. Scheduled from
+     * BeginPlay with settings-driven jitter.
+     */
+    void PrewarmGatewayConnection();
+
+    /** GatewayUrl followed by every non-empty AdditionalGatewayUrls entry. */
+    TArray<FString> GetGatewayUrls() const;
+
+    /** Replica base URL for a rotating index, trailing slash trimmed. */
+    FString GetGatewayBaseUrl(int32 UrlIndex) const;
+
+    int32 SendViaGateway(const FString& UserText);
+    int32 SendViaGatewayWebSocket(const FString& UserText);
+
+    /**
+     * Fire one chat POST at the UrlIndex'th replica. Arms the hedge timer on
+     * the first un-hedged attempt; retries and hedge legs land back in
+     * HandleGatewayResponse like any other chat request.
+     */
+    int32 DispatchGatewayAttempt(const FString& Body, const FString& CacheKey,
+                                 double UtteranceStartSeconds, int32 AttemptIndex,
+                                 int32 UrlIndex, int32 HedgeGroup);
+
+    /**
+     * The single-attempt SSE path. The stream reader is single-flight per
+     * component, so streamed replies don't retry or hedge.
+     */
+    int32 DispatchStreamedGatewayRequest(const FString& Body, const FString& CacheKey,
+                                         double UtteranceStartSeconds);
+
+    /** Re-dispatch a failed chat attempt against the next replica, backed off. */
+    void RetryGatewayAttempt(const FInFlightRequest& Failed);
+
+    /** True while any attempt of the hedge group is still in flight. */
+    bool HasInFlightInGroup(int32 HedgeGroup) const;
+
+    /** Silently cancel the losing legs once one attempt of the group won. */
+    void CancelHedgeSiblings(int32 HedgeGroup);
+
+    /** Pending backoff before a gateway retry (cleared on cancellation). */
+    FTimerHandle GatewayRetryTimer;
+    int32 SendViaDirectOllama(const FString& UserText, const FVRSecretaryChatConfig& Config);
+    int32 SendViaLocalLlamaCpp(const FString& UserText, const FVRSecretaryChatConfig& Config);
+
+    /** One delta/done/error frame from the WebSocket transport (game thread). */
+    void HandleWebSocketMessage(const FString& Message);
 
     void HandleGatewayResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+
+    /**
+     * A chat reply reduced to the fields the component acts on. Produced by
+     * the static parse helpers, which touch no component state and so may
+     * run on the HTTP thread when bProcessResponsesOffGameThread is set.
+     */
+    struct FParsedGatewayReply
+    {
+        bool bValid = false;
+        FString AssistantText;
+
+        /** Inline audio as base64 (DOM path) — the decoded-bytes form is empty. */
+        FString AudioBase64;
+
+        /** Inline audio decoded straight out of the raw body (fast path). */
+        TArray<uint8> AudioWavData;
+
+        FString AudioUrl;
+    };
+
+    /** DirectOllama reply reduced to text, or the specific parse error. */
+    struct FParsedOllamaReply
+    {
+        bool bValid = false;
+        FString AssistantText;
+        FString Error;
+    };
+
+    /**
+     * Extract a gateway chat reply from the raw UTF-8 body: large bodies use
+     * the targeted raw-byte extraction (no TCHAR conversion or DOM around a
+     * giant base64 string, audio decoded straight out of the body view),
+     * small ones fall back to the DOM parser. Thread-safe.
+     */
+    static void ParseGatewayReplyBody(const TArray<uint8>& Body, FParsedGatewayReply& OutParsed);
+
+    /** DOM-parse a gateway chat reply already held as a string. Thread-safe. */
+    static void ParseGatewayReplyString(const FString& Content, FParsedGatewayReply& OutParsed);
+
+    /** Extract the assistant text from an OpenAI-shaped reply. Thread-safe. */
+    static void ParseOllamaReplyBody(const TArray<uint8>& Body, FParsedOllamaReply& OutParsed);
+
+    /**
+     * Game-thread completion stage shared by both delivery policies:
+     * bookkeeping, error/retry/hedge handling, then cache + broadcast of the
+     * parsed reply. PreParsed is the HTTP-thread parse result (moved from),
+     * or null when parsing still has to happen here.
+     */
+    void FinishGatewayResponse(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                               bool bWasSuccessful, FParsedGatewayReply* PreParsed);
+
+    /** Game-thread completion stage for DirectOllama; see FinishGatewayResponse. */
+    void FinishDirectOllamaResponse(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                                    bool bWasSuccessful, FParsedOllamaReply* PreParsed);
+
+    /** Cache, stat and broadcast a successfully parsed chat reply. */
+    void BroadcastGatewayReply(FParsedGatewayReply&& Parsed, const FString& CacheKey,
+                               double UtteranceStartSeconds, int32 GatewayUrlIndex);
+
+    /**
+     * Completion of a prefetch chat POST: cache the reply (RAM + disk) and
+     * quietly download a binary-transport audio_url. No delegates, no
+     * retries — a failed prefetch just means the real send pays full price.
+     */
+    void HandlePrefetchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                                bool bWasSuccessful, const FString& CacheKey);
+
+    /** Completion of a prefetched audio_url download: attach to the cache. */
+    void HandlePrefetchAudioResponse(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                                     bool bWasSuccessful, const FString& CacheKey);
+
+    /** Bodies at least this large take the raw-byte fast path. */
+    static constexpr int32 FastParseThresholdBytes = 64 * 1024;
+
+    /**
+     * Persist a finished reply to the cross-session disk cache, decoding the
+     * base64 audio only when the cache actually wants the entry.
+     */
+    void PersistToDiskCache(const FString& CacheKey, const FString& AssistantText,
+                            const FString& AudioBase64);
     void HandleDirectOllamaResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+
+    /**
+     * Resolve a gateway-relative audio URL and download the raw WAV bytes.
+     * Relative URLs resolve against the replica that served the reply, since
+     * the audio token may be local to it.
+     */
+    void FetchBinaryAudio(const FString& AudioUrl, const FString& CacheKey = FString(),
+                          double UtteranceStartSeconds = -1.0, int32 GatewayUrlIndex = 0);
+    void HandleBinaryAudioResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 };
\ No newline at end of file
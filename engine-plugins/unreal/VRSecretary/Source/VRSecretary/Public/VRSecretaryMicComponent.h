@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "VRSecretaryChatTypes.h"
+#include "VRSecretaryMicComponent.generated.h"
+
+namespace Audio { class FAudioCapture; }
+class FVRSecretaryAudioRingBuffer;
+class FVRSecretaryWebSocketTransport;
+
+/** Fired when voice activity begins (before the first uplink frame). */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FVRSecretaryOnSpeechStarted);
+
+/** Fired when voice activity ends (after the stt_end control frame). */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FVRSecretaryOnSpeechEnded);
+
+/** Fired per transcript update from the gateway; bFinal marks the last one. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+    FVRSecretaryOnTranscript,
+    const FString&, Text,
+    bool, bFinal
+);
+
+/**
+ * Microphone capture component: speech input for the VRSecretary pipeline.
+ *
+ * The audio capture callback (audio render thread) downmixes the device
+ * buffer to mono int16 and pushes it into a lock-free SPSC ring buffer —
+ * zero allocation and zero locks on the audio thread, so capture never
+ * drops frames because the game thread hitched. The game thread drains the
+ * ring each tick, cuts it into fixed frames (FrameDurationMs) and runs a
+ * simple RMS voice-activity detector so silence is never shipped: a short
+ * pre-roll preserves the speech onset and a hangover bridges natural pauses.
+ *
+ * Voiced frames stream to the gateway over a WebSocket at
+ * <GatewayUrl>/ws/stt as raw little-endian int16 mono PCM, bracketed by
+ * JSON control frames:
+ *
+ *     { "type": "stt_begin", "session_id": ..., "sample_rate": ...,
+ *       "channels": 1, "format": "pcm_s16le", "language": ... }
+ *     <binary PCM frames>
+ *     { "type": "stt_end" }
+ *
+ * The gateway answers with { "type": "transcript", "text": ..., "final": ... }
+ * frames, surfaced through OnTranscript. With bAutoSendFinalTranscript the
+ * final transcript feeds straight into a sibling UVRSecretaryComponent, so
+ * speech-in/speech-out needs no Blueprint glue.
+ */
+UCLASS(ClassGroup=(VRSecretary), meta=(BlueprintSpawnableComponent))
+class VRSECRETARY_API UVRSecretaryMicComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UVRSecretaryMicComponent();
+
+    /** Out-of-line so TUniquePtr members can use forward-declared types. */
+    virtual ~UVRSecretaryMicComponent() override;
+
+    /** Open the capture device and start streaming. Safe to call twice. */
+    UFUNCTION(BlueprintCallable, Category="VRSecretary|Mic")
+    bool StartCapture();
+
+    /** Stop capturing; an active utterance is flushed with stt_end first. */
+    UFUNCTION(BlueprintCallable, Category="VRSecretary|Mic")
+    void StopCapture();
+
+    UFUNCTION(BlueprintPure, Category="VRSecretary|Mic")
+    bool IsCapturing() const;
+
+    /** True while the voice-activity detector considers the user speaking. */
+    UFUNCTION(BlueprintPure, Category="VRSecretary|Mic")
+    bool IsSpeechActive() const { return bSpeechActive; }
+
+    /** Begin capturing at BeginPlay without an explicit StartCapture call. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary|Mic")
+    bool bAutoStartCapture = false;
+
+    /** Uplink frame length in milliseconds (20-40 ms is the useful range). */
+    UPROPERTY(EditAnywhere, Category="VRSecretary|Mic", meta=(ClampMin="10", ClampMax="60"))
+    int32 FrameDurationMs = 20;
+
+    /** RMS level (dBFS) above which a frame counts as speech. */
+    UPROPERTY(EditAnywhere, Category="VRSecretary|Mic", meta=(ClampMin="-90.0", ClampMax="0.0"))
+    float VadThresholdDb = -40.0f;
+
+    /**
+     * How long the uplink keeps streaming after the level drops below the
+     * threshold, so natural mid-sentence pauses don't split the utterance.
+     */
+    UPROPERTY(EditAnywhere, Category="VRSecretary|Mic", meta=(ClampMin="0.0", ClampMax="2000.0"))
+    float VadHangoverMs = 400.0f;
+
+    /**
+     * Audio retained from just before the detector triggered and sent ahead
+     * of the first voiced frame, so soft speech onsets aren't clipped.
+     */
+    UPROPERTY(EditAnywhere, Category="VRSecretary|Mic", meta=(ClampMin="0.0", ClampMax="1000.0"))
+    float VadPrerollMs = 200.0f;
+
+    /**
+     * Language hint sent with stt_begin (ISO 639-1). Empty = project default
+     * from VRSecretarySettings.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary|Mic")
+    FString LanguageCode;
+
+    /**
+     * Route the final transcript into a UVRSecretaryComponent on the same
+     * actor via SendUserText, completing the speech-in/speech-out loop.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="VRSecretary|Mic")
+    bool bAutoSendFinalTranscript = true;
+
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary|Mic")
+    FVRSecretaryOnSpeechStarted OnSpeechStarted;
+
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary|Mic")
+    FVRSecretaryOnSpeechEnded OnSpeechEnded;
+
+    /** Partial and final transcripts from the gateway. */
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary|Mic")
+    FVRSecretaryOnTranscript OnTranscript;
+
+    /** Fired on capture-device or uplink failures. */
+    UPROPERTY(BlueprintAssignable, Category="VRSecretary|Mic")
+    FVRSecretaryOnError OnError;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+                               FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+    /** Lazily create the /ws/stt transport and wire its callbacks. */
+    FVRSecretaryWebSocketTransport& GetOrCreateSttTransport();
+
+    void HandleSttMessage(const FString& Message);
+
+    /** Run VAD over one complete frame and stream it when voiced. */
+    void ProcessFrame(const int16* Samples, int32 NumSamples);
+
+    void BeginUtterance();
+    void EndUtterance();
+
+    TUniquePtr<Audio::FAudioCapture> AudioCapture;
+    TUniquePtr<FVRSecretaryAudioRingBuffer> CaptureRing;
+    TSharedPtr<FVRSecretaryWebSocketTransport, ESPMode::ThreadSafe> SttTransport;
+
+    /** Capture format, fixed while the stream is open. */
+    int32 CaptureSampleRate = 0;
+    int32 SamplesPerFrame = 0;
+
+    /** Partial frame carried between ticks until SamplesPerFrame is reached. */
+    TArray<int16> FrameAssembly;
+    int32 FrameFill = 0;
+
+    /** Scratch for draining the ring once per tick. */
+    TArray<int16> DrainScratch;
+
+    /** Circular pre-roll of whole frames, oldest overwritten first. */
+    TArray<int16> PrerollRing;
+    int32 PrerollFrameCapacity = 0;
+    int32 PrerollWriteFrame = 0;
+    int32 PrerollFramesStored = 0;
+
+    bool bCapturing = false;
+    bool bSpeechActive = false;
+    int32 HangoverFramesLeft = 0;
+    uint64 LastReportedDrops = 0;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "VRSecretaryRequestScheduler.generated.h"
+
+/**
+ * Game-instance-wide scheduler for VRSecretary gateway traffic.
+ *
+ * Scenes with dozens of chatting NPCs used to fire HTTP requests with no
+ * coordination: bursts saturated the gateway and background NPCs starved
+ * the one the player was actually facing. Components now route their chat
+ * requests through this subsystem, which enforces a configurable
+ * concurrency budget (UVRSecretarySettings::MaxConcurrentGatewayRequests)
+ * and dispatches queued requests highest-priority first, FIFO within equal
+ * priority (see UVRSecretaryComponent::RequestPriority).
+ *
+ * Coalescing falls out of the component's CancelPrevious policy: a new
+ * utterance cancels that component's queued entries before enqueueing, so
+ * stale requests never reach the gateway.
+ */
+UCLASS()
+class VRSECRETARY_API UVRSecretaryRequestScheduler : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /**
+     * Queue a dispatch. Runs immediately when a slot is free, otherwise when
+     * one opens up. Dispatch returns whether it actually started a request
+     * (a cancelled-while-queued entry returns false and costs no slot).
+     */
+    void Enqueue(UObject* Owner, int32 Priority, TFunction<bool()>&& Dispatch);
+
+    /**
+     * Queue a speculative dispatch (see UVRSecretaryComponent::
+     * PrefetchResponse). Prefetches sort behind every interactive entry
+     * regardless of priority and leave one slot of the budget free for
+     * interactive traffic whenever the budget allows it, so background
+     * warming never delays a request the player is waiting on.
+     */
+    void EnqueuePrefetch(UObject* Owner, TFunction<bool()>&& Dispatch);
+
+    /**
+     * Drop every queued (not yet dispatched) interactive entry belonging to
+     * Owner. Queued prefetches stay: they are background work a superseding
+     * utterance has no reason to discard, and their dispatch lambdas decline
+     * the slot on their own once the owner no longer wants them.
+     */
+    void CancelQueued(UObject* Owner);
+
+    /** A dispatched request completed (success, error, or cancellation). */
+    void NotifyRequestFinished();
+
+    /** Requests currently on the wire. */
+    UFUNCTION(BlueprintPure, Category="VRSecretary")
+    int32 GetNumActiveRequests() const { return NumActive; }
+
+    /** Requests waiting for a free slot. */
+    UFUNCTION(BlueprintPure, Category="VRSecretary")
+    int32 GetNumQueuedRequests() const { return Queue.Num(); }
+
+private:
+    struct FQueuedDispatch
+    {
+        TWeakObjectPtr<UObject> Owner;
+        int32 Priority = 0;
+        bool bPrefetch = false;
+        TFunction<bool()> Dispatch;
+    };
+
+    /** Start queued dispatches until the budget is spent or the queue drains. */
+    void Pump();
+
+    /** Concurrency ceiling for an entry: prefetches reserve one slot. */
+    int32 GetBudgetFor(const FQueuedDispatch& Entry) const;
+
+    /**
+     * Queue ordered highest priority first; FIFO within equal priority.
+     * Prefetch entries always trail the interactive ones.
+     */
+    TArray<FQueuedDispatch> Queue;
+
+    /** Concurrency budget from settings; <= 0 means unlimited. */
+    int32 MaxConcurrent = 4;
+
+    int32 NumActive = 0;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "VRSecretarySessionState.generated.h"
+
+/**
+ * Snapshot of one component's session, compact enough to park across a
+ * level transition: the gateway session identity plus the DirectOllama
+ * conversation window as a binary blob. The process-wide response and disk
+ * caches already survive travel on their own and are not part of this.
+ */
+struct FVRSecretarySessionSnapshot
+{
+    FString SessionId;
+
+    /** FVRSecretaryChatHistory::Serialize bytes; empty when no history. */
+    TArray<uint8> HistoryBlob;
+};
+
+/**
+ * Game-instance-wide parking lot for VRSecretary session state.
+ *
+ * Level travel destroys UVRSecretaryComponents and with them the session
+ * id and conversation context, so the first utterance after a map load
+ * used to restart the conversation cold. Components snapshot themselves
+ * here at EndPlay (keyed by their persistence key) and rehydrate from the
+ * same key at BeginPlay — the gateway sees the same session_id and the
+ * direct backends keep their history window, with no re-handshake since
+ * session identity rides every request. Blobs live in memory only, for
+ * the lifetime of the game instance.
+ */
+UCLASS()
+class VRSECRETARY_API UVRSecretarySessionState : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Park a snapshot under Key, replacing any previous one. */
+    void Store(const FString& Key, FVRSecretarySessionSnapshot&& Snapshot);
+
+    /**
+     * Copy out the snapshot parked under Key, if any. The entry stays, so
+     * repeated loads of the same level keep restoring.
+     */
+    bool Restore(const FString& Key, FVRSecretarySessionSnapshot& OutSnapshot) const;
+
+    /** Forget one parked session (e.g. when a conversation is reset). */
+    void Discard(const FString& Key);
+
+    /** Sessions currently parked. */
+    UFUNCTION(BlueprintPure, Category="VRSecretary")
+    int32 GetNumSnapshots() const { return Snapshots.Num(); }
+
+private:
+    TMap<FString, FVRSecretarySessionSnapshot> Snapshots;
+};
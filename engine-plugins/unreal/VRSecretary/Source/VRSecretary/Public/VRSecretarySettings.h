@@ -36,10 +36,98 @@ public:
     ))
     FString DefaultLanguageCode;
 
+    /**
+     * Additional gateway replica URLs (same deployment behind different
+     * hosts). Retries rotate through them, and hedged requests race a second
+     * replica against a slow first one. The session socket, SSE streams and
+     * prewarm always use GatewayUrl.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="Gateway", meta=(
+        DisplayName="Additional Gateway URLs"
+    ))
+    TArray<FString> AdditionalGatewayUrls;
+
     /** HTTP timeout in seconds for all backend calls. */
     UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(ClampMin="1.0", UIMin="1.0"))
     float HttpTimeout;
 
+    /**
+     * Warm up the gateway connection at BeginPlay with a lightweight
+     * GET /health, so the first utterance doesn't pay DNS + TCP + TLS setup.
+     * In WebSocket mode the prewarm opens the session socket instead.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(
+        DisplayName="Prewarm Gateway Connection"
+    ))
+    bool bPrewarmGatewayConnection;
+
+    /**
+     * Game-instance-wide budget for concurrent gateway chat requests,
+     * enforced by UVRSecretaryRequestScheduler. Requests over budget queue
+     * and dispatch highest-priority first. 0 = unlimited (no scheduling).
+     */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(ClampMin="0", UIMin="0"))
+    int32 MaxConcurrentGatewayRequests;
+
+    /**
+     * Each component delays its prewarm by a random amount up to this many
+     * seconds, so servers with hundreds of components don't stampede the
+     * gateway on level start. 0 = prewarm immediately.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(
+        ClampMin="0.0", UIMin="0.0", EditCondition="bPrewarmGatewayConnection"
+    ))
+    float PrewarmMaxJitterSeconds;
+
+    /**
+     * How many times a failed gateway chat request (transport error or HTTP
+     * 5xx) is retried before OnError fires. Each retry targets the next
+     * replica URL with exponentially growing backoff. 0 = fail immediately.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(ClampMin="0", UIMin="0"))
+    int32 MaxGatewayRetries;
+
+    /** Backoff before the first retry; doubles per attempt. */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(
+        ClampMin="0.0", UIMin="0.0", EditCondition="MaxGatewayRetries > 0"
+    ))
+    float GatewayRetryBackoffSeconds;
+
+    /**
+     * Hedge gateway chat requests for tail-latency control: when a reply
+     * hasn't arrived within HedgeThresholdSeconds, a duplicate request races
+     * against another replica and the first reply wins (the loser is
+     * cancelled silently). Needs at least one AdditionalGatewayUrls entry;
+     * trades extra gateway load for a tighter p99.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(
+        DisplayName="Hedge Gateway Requests"
+    ))
+    bool bHedgeGatewayRequests;
+
+    /** In-flight time after which a request is hedged. */
+    UPROPERTY(EditAnywhere, Config, Category="HTTP", meta=(
+        ClampMin="0.05", UIMin="0.05", EditCondition="bHedgeGatewayRequests"
+    ))
+    float HedgeThresholdSeconds;
+
+    /**
+     * Budget (MB) for the in-memory response cache of repeated phrases
+     * (assistant text + audio, keyed by user text and language). 0 disables
+     * caching entirely.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="Cache", meta=(ClampMin="0", UIMin="0"))
+    int32 ResponseCacheSizeMB;
+
+    /**
+     * Budget (MB) for the persistent audio cache file under Saved/VRSecretary.
+     * Unlike the in-memory cache it survives restarts, so recurring lines
+     * (kiosk greetings, warm-up chatter) answer instantly from disk on the
+     * next launch instead of paying LLM + TTS round-trips. 0 disables.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="Cache", meta=(ClampMin="0", UIMin="0"))
+    int32 DiskAudioCacheSizeMB;
+
     /** Base URL of the Ollama server (for DirectOllama mode). */
     UPROPERTY(EditAnywhere, Config, Category="Direct Ollama")
     FString DirectOllamaUrl;
@@ -48,6 +136,38 @@ public:
     UPROPERTY(EditAnywhere, Config, Category="Direct Ollama")
     FString DirectOllamaModel;
 
+    /**
+     * How many past turns (user + assistant messages) each component keeps
+     * for DirectOllama conversations. The window is a preallocated ring
+     * buffer: the oldest turn drops when full.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="Direct Ollama", meta=(ClampMin="1", UIMin="1"))
+    int32 DirectOllamaMaxHistoryTurns;
+
+    /**
+     * Approximate token budget (~4 chars/token) for the history window; the
+     * oldest turns are dropped when the conversation exceeds it. 0 = only
+     * the turn cap applies.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="Direct Ollama", meta=(ClampMin="0", UIMin="0"))
+    int32 DirectOllamaHistoryTokenBudget;
+
+    /**
+     * GGUF model file for the LocalLlamaCpp backend. Loaded (memory-mapped)
+     * once at module startup on a dedicated worker thread. Leave empty to
+     * keep the local backend disabled.
+     */
+    UPROPERTY(EditAnywhere, Config, Category="Local Llama.cpp")
+    FFilePath LocalLlamaModelPath;
+
+    /** Context window (tokens) for the local llama.cpp context. */
+    UPROPERTY(EditAnywhere, Config, Category="Local Llama.cpp", meta=(ClampMin="512", UIMin="512"))
+    int32 LocalLlamaContextSize;
+
+    /** Inference threads for llama.cpp. 0 = half the logical cores. */
+    UPROPERTY(EditAnywhere, Config, Category="Local Llama.cpp", meta=(ClampMin="0", UIMin="0"))
+    int32 LocalLlamaThreads;
+
     // UDeveloperSettings interface
     virtual FName GetCategoryName() const override;
 };
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Stat group for the VRSecretary hot path, visible via `stat VRSecretary`
+ * and mirrored into the CSV profiler (category "VRSecretary") for telemetry.
+ *
+ * The request pipeline is timed per stage so latency regressions can be
+ * pinned down without UE_LOG archaeology: request serialization, wire time,
+ * response JSON parse, and end-to-end time-to-first-audio live here; the
+ * decode-side stages (base64, WAV parse, PCM copy) are reported into the
+ * same group by the consuming game's decoder.
+ */
+DECLARE_STATS_GROUP(TEXT("VRSecretary"), STATGROUP_VRSecretary, STATCAT_Advanced);
+
+/** CPU time spent building and serializing the request JSON payload. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Request Serialize"), STAT_VRSecretary_RequestSerialize, STATGROUP_VRSecretary, VRSECRETARY_API);
+
+/** CPU time spent parsing the response JSON body. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Response JSON Parse"), STAT_VRSecretary_JsonParse, STATGROUP_VRSecretary, VRSECRETARY_API);
+
+/** Wall-clock time from ProcessRequest to the completion callback (ms). */
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Network Time (ms)"), STAT_VRSecretary_NetworkTimeMs, STATGROUP_VRSecretary, VRSECRETARY_API);
+
+/** Game-thread time draining the mic ring buffer: framing, VAD, uplink. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mic Frame Process"), STAT_VRSecretary_MicFrameProcess, STATGROUP_VRSecretary, VRSECRETARY_API);
+
+/** Wall-clock time from SendUserText to audio being available (ms). */
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Time To First Audio (ms)"), STAT_VRSecretary_TimeToFirstAudioMs, STATGROUP_VRSecretary, VRSECRETARY_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(VRSECRETARY_API, VRSecretary);
@@ -1,3 +1,4 @@
+using System.IO;
 using UnrealBuildTool;
 
 public class VRSecretary : ModuleRules
@@ -22,13 +23,38 @@ public class VRSecretary : ModuleRules
             new string[]
             {
                 "Projects",
-                "DeveloperSettings"
+                "DeveloperSettings",
+                "WebSockets",
+                "AudioCaptureCore"
             }
         );
 
+        // Native llama.cpp: enabled automatically when the third-party
+        // headers/libs are dropped in (see ThirdParty/LlamaCpp/README.txt).
+        string LlamaCppDir = Path.Combine(ModuleDirectory, "..", "..", "ThirdParty", "LlamaCpp");
+        string LlamaInclude = Path.Combine(LlamaCppDir, "Include");
+        bool bWithLocalLlama = File.Exists(Path.Combine(LlamaInclude, "llama.h"));
+        if (bWithLocalLlama)
+        {
+            PrivateIncludePaths.Add(LlamaInclude);
+
+            string LlamaLibDir = Path.Combine(LlamaCppDir, "Lib", Target.Platform.ToString());
+            if (Directory.Exists(LlamaLibDir))
+            {
+                foreach (string Lib in Directory.GetFiles(LlamaLibDir, "*.lib"))
+                {
+                    PublicAdditionalLibraries.Add(Lib);
+                }
+                foreach (string Lib in Directory.GetFiles(LlamaLibDir, "*.a"))
+                {
+                    PublicAdditionalLibraries.Add(Lib);
+                }
+            }
+        }
+
         // feature flags
         PublicDefinitions.Add("VRSECRETARY_WITH_GATEWAY=1");
         PublicDefinitions.Add("VRSECRETARY_WITH_DIRECT_OLLAMA=1");
-        PublicDefinitions.Add("VRSECRETARY_WITH_LOCAL_LLAMA_STUB=1");
+        PublicDefinitions.Add("VRSECRETARY_WITH_LOCAL_LLAMA=" + (bWithLocalLlama ? "1" : "0"));
     }
 }
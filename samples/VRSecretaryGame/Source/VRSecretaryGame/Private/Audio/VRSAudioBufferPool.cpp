@@ -0,0 +1,83 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSAudioBufferPool.h"
+
+FVRSAudioBufferPool& FVRSAudioBufferPool::Get()
+{
+    static FVRSAudioBufferPool Instance;
+    return Instance;
+}
+
+int32 FVRSAudioBufferPool::BucketIndexForAcquire(int32 Bytes)
+{
+    int32 ClassBytes = MinBucketBytes;
+    for (int32 Index = 0; Index < NumBuckets; ++Index)
+    {
+        if (Bytes <= ClassBytes)
+        {
+            return Index;
+        }
+        ClassBytes <<= 1;
+    }
+    return INDEX_NONE;
+}
+
+int32 FVRSAudioBufferPool::BucketIndexForRelease(int32 CapacityBytes)
+{
+    if (CapacityBytes < MinBucketBytes)
+    {
+        return INDEX_NONE;
+    }
+
+    // Largest class the capacity still covers, so every buffer parked in
+    // bucket N can serve any acquire that maps to bucket N.
+    int32 BestIndex = INDEX_NONE;
+    int32 ClassBytes = MinBucketBytes;
+    for (int32 Index = 0; Index < NumBuckets; ++Index)
+    {
+        if (CapacityBytes >= ClassBytes)
+        {
+            BestIndex = Index;
+        }
+        ClassBytes <<= 1;
+    }
+    return BestIndex;
+}
+
+TArray<uint8> FVRSAudioBufferPool::Acquire(int32 MinCapacityBytes)
+{
+    const int32 BucketIndex = BucketIndexForAcquire(MinCapacityBytes);
+    if (BucketIndex != INDEX_NONE)
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (Buckets[BucketIndex].Num() > 0)
+        {
+            return Buckets[BucketIndex].Pop(/*bAllowShrinking=*/false);
+        }
+    }
+
+    // Miss (or oversize request): allocate fresh, rounded up to the class
+    // size so the buffer re-buckets cleanly on release.
+    TArray<uint8> Buffer;
+    Buffer.Reserve(BucketIndex != INDEX_NONE
+        ? MinBucketBytes << BucketIndex
+        : MinCapacityBytes);
+    return Buffer;
+}
+
+void FVRSAudioBufferPool::Release(TArray<uint8>&& Buffer)
+{
+    const int32 BucketIndex = BucketIndexForRelease(Buffer.Max());
+    if (BucketIndex == INDEX_NONE)
+    {
+        return; // Tiny or oversize; let it free normally.
+    }
+
+    Buffer.Reset();
+
+    FScopeLock ScopeLock(&Lock);
+    if (Buckets[BucketIndex].Num() < MaxBuffersPerBucket)
+    {
+        Buckets[BucketIndex].Add(MoveTemp(Buffer));
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Recycles the transient byte buffers the audio decoder churns through
+ * (base64-decoded WAV bytes, staged PCM). With many NPCs chatting, every
+ * reply used to be a fresh multi-hundred-KB allocation that died moments
+ * later; over long server sessions that is measurable allocator contention
+ * and fragmentation. Buffers are bucketed by power-of-two capacity class
+ * and handed back out with their allocation intact, so steady-state decode
+ * traffic stops hitting the allocator entirely.
+ *
+ * Thread-safe; decode work runs on the task graph.
+ */
+class FVRSAudioBufferPool
+{
+public:
+    static FVRSAudioBufferPool& Get();
+
+    /**
+     * Get a buffer with at least MinCapacityBytes reserved. The buffer comes
+     * back empty (Num() == 0); size it with SetNumUninitialized as usual.
+     */
+    TArray<uint8> Acquire(int32 MinCapacityBytes);
+
+    /** Return a buffer to the pool. Contents are discarded, capacity is kept. */
+    void Release(TArray<uint8>&& Buffer);
+
+private:
+    /** Capacity classes: 4 KB << Index, i.e. 4 KB .. 4 MB. */
+    static constexpr int32 MinBucketBytes = 4 * 1024;
+    static constexpr int32 NumBuckets = 11;
+
+    /** Per-bucket retention cap; anything beyond this is simply freed. */
+    static constexpr int32 MaxBuffersPerBucket = 8;
+
+    /** Smallest class that fits Bytes, or INDEX_NONE when over the largest. */
+    static int32 BucketIndexForAcquire(int32 Bytes);
+
+    /** Largest class a buffer of this capacity can serve, or INDEX_NONE. */
+    static int32 BucketIndexForRelease(int32 CapacityBytes);
+
+    FCriticalSection Lock;
+    TArray<TArray<uint8>> Buckets[NumBuckets];
+};
@@ -1,6 +1,15 @@
 // Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
 
 #include "Audio/VRSAudioDecoder.h"
+#include "Audio/VRSProceduralWavStream.h"
+#include "Audio/VRSSegmentedAudioStream.h"
+#include "Async/Async.h"
+#include "Audio/VRSAudioBufferPool.h"
+#include "Audio/VRSAudioStats.h"
+#include "Audio/VRSBase64.h"
+#include "Audio/VRSOpusDecoder.h"
+#include "Audio/VRSAudioResample.h"
+#include "Audio/VRSWavStreamParser.h"
 #include "Misc/Base64.h"
 #include "Sound/SoundWave.h"
 #include "AudioDevice.h"
@@ -17,225 +26,473 @@ USoundWave* UVRSAudioDecoder::DecodeBase64WavToSoundWave(const FString& Base64St
         return nullptr;
     }
 
-    // Step 1: Decode Base64 to raw bytes
-    TArray<uint8> WavData;
-    if (!FBase64::Decode(Base64String, WavData))
+    // Step 1: Decode Base64 to raw bytes, then share the byte path with the
+    // binary transport entry point. The scratch buffer is pooled: base64
+    // writes straight into recycled capacity instead of a fresh allocation,
+    // and the decode adopts it as backing storage — no staging copy.
+    TArray<uint8> WavData = FVRSAudioBufferPool::Get().Acquire(Base64String.Len() / 4 * 3);
+    if (!VRSBase64::Decode(Base64String, WavData))
     {
         UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWave: Base64 decode failed"));
+        FVRSAudioBufferPool::Get().Release(MoveTemp(WavData));
         return nullptr;
     }
 
-    // Sanity check: minimum WAV size (44 bytes header)
-    if (WavData.Num() < 44)
+    FVRSDecodedWav Decoded;
+    if (!DecodeWavBytesInternal(MoveTemp(WavData), Decoded))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWave: WAV data too small (%d bytes)"), WavData.Num());
         return nullptr;
     }
+    return CreateSoundWaveFromDecoded(MoveTemp(Decoded));
+}
 
-    // Step 2: Parse WAV header
-    int32 SampleRate = 0;
-    int32 NumChannels = 0;
-    int32 BitsPerSample = 0;
-    int32 DataOffset = 0;
-    int32 DataSize = 0;
-
-    if (!ParseWavHeader(WavData, SampleRate, NumChannels, BitsPerSample, DataOffset, DataSize))
+USoundWave* UVRSAudioDecoder::DecodeWavBytesToSoundWave(const TArray<uint8>& WavData)
+{
+    FVRSDecodedWav Decoded;
+    if (!DecodeWavBytesInternal(WavData, Decoded))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWave: Failed to parse WAV header"));
         return nullptr;
     }
 
-    UE_LOG(LogVRSAudioDecoder, Verbose, 
-           TEXT("Parsed WAV: %d Hz, %d channels, %d bits/sample, %d bytes data"),
-           SampleRate, NumChannels, BitsPerSample, DataSize);
+    return CreateSoundWaveFromDecoded(MoveTemp(Decoded));
+}
+
+void UVRSAudioDecoder::DecodeBase64WavToSoundWaveAsync(const FString& Base64String,
+                                                       const FVRSOnSoundWaveDecoded& OnDecoded)
+{
+    if (Base64String.IsEmpty())
+    {
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWaveAsync: Empty Base64 string"));
+        OnDecoded.ExecuteIfBound(nullptr);
+        return;
+    }
+
+    // Prime the device-rate cache while still on the game thread; the task
+    // graph cannot query the audio device itself.
+    VRSAudioResample::GetCachedDeviceSampleRate();
+
+    // Capture the string by value; base64 decode + WAV parse + PCM copy all
+    // happen on the task graph, only USoundWave creation returns to the game
+    // thread.
+    Async(EAsyncExecution::TaskGraph, [Base64String, OnDecoded]()
+    {
+        FVRSDecodedWav Decoded;
+        bool bOk = false;
+
+        TArray<uint8> WavData = FVRSAudioBufferPool::Get().Acquire(Base64String.Len() / 4 * 3);
+        if (VRSBase64::Decode(Base64String, WavData))
+        {
+            bOk = DecodeWavBytesInternal(MoveTemp(WavData), Decoded);
+        }
+        else
+        {
+            UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWaveAsync: Base64 decode failed"));
+            FVRSAudioBufferPool::Get().Release(MoveTemp(WavData));
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [Decoded = MoveTemp(Decoded), bOk, OnDecoded]() mutable
+        {
+            USoundWave* SoundWave = bOk ? CreateSoundWaveFromDecoded(MoveTemp(Decoded)) : nullptr;
+            OnDecoded.ExecuteIfBound(SoundWave);
+        });
+    });
+}
+
+void UVRSAudioDecoder::DecodeWavBytesToSoundWaveAsync(const TArray<uint8>& WavData,
+                                                      const FVRSOnSoundWaveDecoded& OnDecoded)
+{
+    // The Blueprint path cannot transfer ownership, so the one capture copy
+    // here is the price of the borrowed buffer; it then flows through the
+    // move path without further staging.
+    TArray<uint8> OwnedCopy = WavData;
+    DecodeWavBytesToSoundWaveAsync(MoveTemp(OwnedCopy), OnDecoded);
+}
+
+void UVRSAudioDecoder::DecodeWavBytesToSoundWaveAsync(TArray<uint8>&& WavData,
+                                                      const FVRSOnSoundWaveDecoded& OnDecoded)
+{
+    VRSAudioResample::GetCachedDeviceSampleRate();
+
+    Async(EAsyncExecution::TaskGraph, [WavData = MoveTemp(WavData), OnDecoded]() mutable
+    {
+        FVRSDecodedWav Decoded;
+        const bool bOk = DecodeWavBytesInternal(MoveTemp(WavData), Decoded);
+
+        AsyncTask(ENamedThreads::GameThread, [Decoded = MoveTemp(Decoded), bOk, OnDecoded]() mutable
+        {
+            USoundWave* SoundWave = bOk ? CreateSoundWaveFromDecoded(MoveTemp(Decoded)) : nullptr;
+            OnDecoded.ExecuteIfBound(SoundWave);
+        });
+    });
+}
 
-    // Step 3: Validate parameters
-    if (SampleRate < 8000 || SampleRate > 48000)
+USoundWave* UVRSAudioDecoder::DecodeBase64OpusToSoundWave(const FString& Base64String)
+{
+    if (Base64String.IsEmpty())
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid sample rate: %d Hz"), SampleRate);
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64OpusToSoundWave: Empty Base64 string"));
         return nullptr;
     }
 
-    if (NumChannels < 1 || NumChannels > 2)
+    TArray<uint8> OggData = FVRSAudioBufferPool::Get().Acquire(Base64String.Len() / 4 * 3);
+    if (!VRSBase64::Decode(Base64String, OggData))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid channel count: %d"), NumChannels);
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64OpusToSoundWave: Base64 decode failed"));
+        FVRSAudioBufferPool::Get().Release(MoveTemp(OggData));
         return nullptr;
     }
 
-    if (BitsPerSample != 16)
+    FVRSDecodedWav Decoded;
+    const bool bOk = VRSOpus::Decode(OggData, Decoded);
+    FVRSAudioBufferPool::Get().Release(MoveTemp(OggData));
+    return bOk ? CreateSoundWaveFromDecoded(MoveTemp(Decoded)) : nullptr;
+}
+
+USoundWave* UVRSAudioDecoder::DecodeAudioBytesToSoundWave(const TArray<uint8>& AudioData)
+{
+    FVRSDecodedWav Decoded;
+    if (!DecodeAudioBytesInternal(AudioData, Decoded))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, 
-               TEXT("Unsupported bits per sample: %d (only 16-bit PCM supported)"), 
-               BitsPerSample);
         return nullptr;
     }
 
-    // Step 4: Create USoundWave
-    USoundWave* SoundWave = NewObject<USoundWave>(GetTransientPackage(), NAME_None, RF_Transient);
-    if (!SoundWave)
+    return CreateSoundWaveFromDecoded(MoveTemp(Decoded));
+}
+
+void UVRSAudioDecoder::DecodeAudioBytesToSoundWaveAsync(const TArray<uint8>& AudioData,
+                                                        const FVRSOnSoundWaveDecoded& OnDecoded)
+{
+    TArray<uint8> OwnedCopy = AudioData;
+    DecodeAudioBytesToSoundWaveAsync(MoveTemp(OwnedCopy), OnDecoded);
+}
+
+void UVRSAudioDecoder::DecodeAudioBytesToSoundWaveAsync(TArray<uint8>&& AudioData,
+                                                        const FVRSOnSoundWaveDecoded& OnDecoded)
+{
+    VRSAudioResample::GetCachedDeviceSampleRate();
+
+    Async(EAsyncExecution::TaskGraph, [AudioData = MoveTemp(AudioData), OnDecoded]() mutable
+    {
+        FVRSDecodedWav Decoded;
+        const bool bOk = DecodeAudioBytesInternal(MoveTemp(AudioData), Decoded);
+
+        AsyncTask(ENamedThreads::GameThread, [Decoded = MoveTemp(Decoded), bOk, OnDecoded]() mutable
+        {
+            USoundWave* SoundWave = bOk ? CreateSoundWaveFromDecoded(MoveTemp(Decoded)) : nullptr;
+            OnDecoded.ExecuteIfBound(SoundWave);
+        });
+    });
+}
+
+USoundWave* UVRSAudioDecoder::DecodeAudioBytesToSoundWave(TArray<uint8>&& AudioData)
+{
+    FVRSDecodedWav Decoded;
+    if (!DecodeAudioBytesInternal(MoveTemp(AudioData), Decoded))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Failed to create USoundWave object"));
         return nullptr;
     }
 
-    // Step 5: Configure SoundWave properties
-    SoundWave->SetSampleRate(SampleRate);
-    SoundWave->NumChannels = NumChannels;
-    SoundWave->Duration = (float)DataSize / (float)(SampleRate * NumChannels * 2); // 2 bytes per sample (16-bit)
-    SoundWave->RawPCMDataSize = DataSize;
-    SoundWave->SoundGroup = SOUNDGROUP_Default;
+    return CreateSoundWaveFromDecoded(MoveTemp(Decoded));
+}
+
+USoundWave* UVRSAudioDecoder::DecodeBase64WavToSoundWaveWithEnvelope(const FString& Base64String,
+                                                                    float EnvelopeWindowMs,
+                                                                    FVRSLipSyncEnvelope& OutEnvelope)
+{
+    OutEnvelope = FVRSLipSyncEnvelope();
 
-    // Step 6: Copy audio data to SoundWave
-    // Unreal expects raw PCM data without WAV header
-    const int32 AudioDataSize = WavData.Num() - DataOffset;
-    if (AudioDataSize != DataSize)
+    if (Base64String.IsEmpty())
     {
-        UE_LOG(LogVRSAudioDecoder, Warning, 
-               TEXT("Data size mismatch: header says %d, actual %d"), 
-               DataSize, AudioDataSize);
-        // Use smaller value to be safe
-        DataSize = FMath::Min(DataSize, AudioDataSize);
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWaveWithEnvelope: Empty Base64 string"));
+        return nullptr;
     }
 
-    // Allocate and copy PCM data
-    SoundWave->RawPCMData = (uint8*)FMemory::Malloc(DataSize);
-    if (!SoundWave->RawPCMData)
+    TArray<uint8> WavData = FVRSAudioBufferPool::Get().Acquire(Base64String.Len() / 4 * 3);
+    if (!VRSBase64::Decode(Base64String, WavData))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Failed to allocate %d bytes for PCM data"), DataSize);
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeBase64WavToSoundWaveWithEnvelope: Base64 decode failed"));
+        FVRSAudioBufferPool::Get().Release(MoveTemp(WavData));
         return nullptr;
     }
 
-    FMemory::Memcpy(SoundWave->RawPCMData, WavData.GetData() + DataOffset, DataSize);
+    FVRSDecodedWav Decoded;
+    if (!DecodeWavBytesInternal(MoveTemp(WavData), Decoded))
+    {
+        return nullptr;
+    }
 
-    // Step 7: Finalize SoundWave
-    SoundWave->InvalidateCompressedData();
+    // Extract the envelope now, while the PCM is still hot in cache, so the
+    // animation tick never re-reads the samples.
+    VRSAudioEnvelope::Compute((const int16*)Decoded.GetPcmData(),
+                              Decoded.GetPcmNumBytes() / (int32)sizeof(int16),
+                              Decoded.NumChannels, Decoded.SampleRate,
+                              EnvelopeWindowMs, OutEnvelope);
 
-    UE_LOG(LogVRSAudioDecoder, Log, 
-           TEXT("Successfully created SoundWave: %.2f seconds, %d Hz, %d channels"),
-           SoundWave->Duration, SampleRate, NumChannels);
+    return CreateSoundWaveFromDecoded(MoveTemp(Decoded));
+}
 
-    return SoundWave;
+void UVRSAudioDecoder::DecodeAudioBytesToSoundWaveWithEnvelopeAsync(const TArray<uint8>& AudioData,
+                                                                    float EnvelopeWindowMs,
+                                                                    const FVRSOnSoundWaveDecodedWithEnvelope& OnDecoded)
+{
+    VRSAudioResample::GetCachedDeviceSampleRate();
+
+    Async(EAsyncExecution::TaskGraph, [AudioData, EnvelopeWindowMs, OnDecoded]()
+    {
+        FVRSDecodedWav Decoded;
+        FVRSLipSyncEnvelope Envelope;
+        const bool bOk = DecodeAudioBytesInternal(AudioData, Decoded);
+        if (bOk)
+        {
+            VRSAudioEnvelope::Compute((const int16*)Decoded.GetPcmData(),
+                                      Decoded.GetPcmNumBytes() / (int32)sizeof(int16),
+                                      Decoded.NumChannels, Decoded.SampleRate,
+                                      EnvelopeWindowMs, Envelope);
+        }
+
+        AsyncTask(ENamedThreads::GameThread,
+                  [Decoded = MoveTemp(Decoded), Envelope = MoveTemp(Envelope), bOk, OnDecoded]() mutable
+        {
+            USoundWave* SoundWave = bOk ? CreateSoundWaveFromDecoded(MoveTemp(Decoded)) : nullptr;
+            OnDecoded.ExecuteIfBound(SoundWave, Envelope);
+        });
+    });
 }
 
-bool UVRSAudioDecoder::ParseWavHeader(
-    const TArray<uint8>& WavData,
-    int32& OutSampleRate,
-    int32& OutNumChannels,
-    int32& OutBitsPerSample,
-    int32& OutDataOffset,
-    int32& OutDataSize)
-{
-    // WAV file structure:
-    // Offset | Size | Description
-    // -------|------|-------------
-    // 0      | 4    | "RIFF"
-    // 4      | 4    | File size - 8
-    // 8      | 4    | "WAVE"
-    // 12     | 4    | "fmt "
-    // 16     | 4    | Format chunk size (16 for PCM)
-    // 20     | 2    | Audio format (1 = PCM)
-    // 22     | 2    | Num channels
-    // 24     | 4    | Sample rate
-    // 28     | 4    | Byte rate
-    // 32     | 2    | Block align
-    // 34     | 2    | Bits per sample
-    // 36     | 4    | "data"
-    // 40     | 4    | Data size
-
-    // Check RIFF header
-    if (WavData[0] != 'R' || WavData[1] != 'I' || WavData[2] != 'F' || WavData[3] != 'F')
-    {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid WAV: Missing RIFF header"));
-        return false;
+float UVRSAudioDecoder::GetEnvelopeLevelAtTime(const FVRSLipSyncEnvelope& Envelope, float TimeSeconds)
+{
+    if (Envelope.RMS.Num() == 0 || Envelope.WindowSeconds <= 0.0f)
+    {
+        return 0.0f;
     }
 
-    // Check WAVE format
-    if (WavData[8] != 'W' || WavData[9] != 'A' || WavData[10] != 'V' || WavData[11] != 'E')
+    const float Position = TimeSeconds / Envelope.WindowSeconds;
+    const int32 Index = FMath::Clamp(FMath::FloorToInt(Position), 0, Envelope.RMS.Num() - 1);
+    const int32 Next = FMath::Min(Index + 1, Envelope.RMS.Num() - 1);
+    const float Alpha = FMath::Clamp(Position - (float)Index, 0.0f, 1.0f);
+    return FMath::Lerp(Envelope.RMS[Index], Envelope.RMS[Next], Alpha);
+}
+
+UVRSProceduralWavStream* UVRSAudioDecoder::CreateWavStream()
+{
+    return NewObject<UVRSProceduralWavStream>(GetTransientPackage(), NAME_None, RF_Transient);
+}
+
+UVRSSegmentedAudioStream* UVRSAudioDecoder::CreateSegmentedStream()
+{
+    return NewObject<UVRSSegmentedAudioStream>(GetTransientPackage(), NAME_None, RF_Transient);
+}
+
+namespace
+{
+    /**
+     * Shared parse stage for both the borrowed and owned WAV decode paths:
+     * validates the container and locates the payload as an offset/size view
+     * into WavData. Fills the format fields of OutDecoded.
+     */
+    bool ParseWavPayloadView(const TArray<uint8>& WavData, FVRSDecodedWav& OutDecoded,
+                             int32& OutPcmOffset, int32& OutPcmBytes)
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid WAV: Missing WAVE format"));
-        return false;
+        // Sanity check: minimum WAV size (44 bytes header)
+        if (WavData.Num() < 44)
+        {
+            UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeWavBytesInternal: WAV data too small (%d bytes)"), WavData.Num());
+            return false;
+        }
+
+        // Step 2: Parse the container with the shared incremental parser.
+        // The whole buffer goes in as one feed, so the payload arrives as a
+        // single contiguous span; format validation happens in the parser.
+        FVRSWavStreamParser Parser;
+        const uint8* PcmStart = nullptr;
+        int64 PcmBytes = 0;
+
+        {
+            SCOPE_CYCLE_COUNTER(STAT_VRSecretary_WavParse);
+            CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, WavParse);
+
+            Parser.Feed(WavData.GetData(), WavData.Num(),
+                        [&PcmStart, &PcmBytes](const uint8* Pcm, int32 NumPcmBytes)
+            {
+                if (!PcmStart)
+                {
+                    PcmStart = Pcm;
+                }
+                PcmBytes += NumPcmBytes;
+            });
+        }
+
+        if (Parser.HasFailed() || !Parser.HasFoundData())
+        {
+            UE_LOG(LogVRSAudioDecoder, Error, TEXT("DecodeWavBytesInternal: Failed to parse WAV header"));
+            return false;
+        }
+
+        UE_LOG(LogVRSAudioDecoder, Verbose,
+               TEXT("Parsed WAV: %d Hz, %d channels, %d bits/sample, %lld bytes data"),
+               Parser.GetSampleRate(), Parser.GetNumChannels(), Parser.GetBitsPerSample(), PcmBytes);
+
+        // A declared size past the end of the buffer — truncated download or
+        // a writer that guessed — clamps to what actually arrived.
+        const int64 DeclaredDataSize = Parser.GetDeclaredDataSize();
+        if (DeclaredDataSize != INDEX_NONE && DeclaredDataSize != PcmBytes)
+        {
+            UE_LOG(LogVRSAudioDecoder, Warning,
+                   TEXT("Data size mismatch: header says %lld, actual %lld"),
+                   DeclaredDataSize, PcmBytes);
+        }
+
+        OutDecoded.SampleRate = Parser.GetSampleRate();
+        OutDecoded.NumChannels = Parser.GetNumChannels();
+        OutPcmOffset = PcmStart ? (int32)(PcmStart - WavData.GetData()) : 0;
+        OutPcmBytes = (int32)PcmBytes;
+        return true;
     }
+}
 
-    // Check fmt chunk
-    if (WavData[12] != 'f' || WavData[13] != 'm' || WavData[14] != 't' || WavData[15] != ' ')
+bool UVRSAudioDecoder::DecodeWavBytesInternal(const TArray<uint8>& WavData, FVRSDecodedWav& OutDecoded)
+{
+    int32 PcmOffset = 0;
+    int32 PcmBytes = 0;
+    if (!ParseWavPayloadView(WavData, OutDecoded, PcmOffset, PcmBytes))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid WAV: Missing fmt chunk"));
         return false;
     }
 
-    // Read format chunk size
-    const int32 FmtChunkSize = ReadInt32(WavData, 16);
-    if (FmtChunkSize < 16)
+    // Borrowed input: the payload must outlive WavData, so it is staged
+    // into a pooled buffer. C++ callers that own their bytes should prefer
+    // the move overload, which skips this copy entirely.
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid WAV: fmt chunk too small"));
-        return false;
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_PcmCopy);
+        CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, PcmCopy);
+
+        OutDecoded.Backing = FVRSAudioBufferPool::Get().Acquire(PcmBytes);
+        OutDecoded.Backing.SetNumUninitialized(PcmBytes);
+        if (PcmBytes > 0)
+        {
+            FMemory::Memcpy(OutDecoded.Backing.GetData(), WavData.GetData() + PcmOffset, PcmBytes);
+        }
+        OutDecoded.PcmOffset = 0;
+        OutDecoded.PcmNumBytes = PcmBytes;
     }
 
-    // Read audio format (must be 1 for PCM)
-    const int16 AudioFormat = ReadInt16(WavData, 20);
-    if (AudioFormat != 1)
+    ResampleToDeviceRate(OutDecoded);
+    return true;
+}
+
+bool UVRSAudioDecoder::DecodeWavBytesInternal(TArray<uint8>&& WavData, FVRSDecodedWav& OutDecoded)
+{
+    int32 PcmOffset = 0;
+    int32 PcmBytes = 0;
+    if (!ParseWavPayloadView(WavData, OutDecoded, PcmOffset, PcmBytes))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Unsupported WAV format: %d (only PCM=1 supported)"), AudioFormat);
+        FVRSAudioBufferPool::Get().Release(MoveTemp(WavData));
         return false;
     }
 
-    // Read audio parameters
-    OutNumChannels = ReadInt16(WavData, 22);
-    OutSampleRate = ReadInt32(WavData, 24);
-    OutBitsPerSample = ReadInt16(WavData, 34);
+    // Owned input: adopt the whole buffer as backing and view past the
+    // header — the payload is never staged.
+    OutDecoded.Backing = MoveTemp(WavData);
+    OutDecoded.PcmOffset = PcmOffset;
+    OutDecoded.PcmNumBytes = PcmBytes;
 
-    // Find data chunk (might not be at offset 36 if there are extra chunks)
-    int32 Offset = 36;
-    bool FoundData = false;
+    ResampleToDeviceRate(OutDecoded);
+    return true;
+}
 
-    while (Offset + 8 <= WavData.Num())
+bool UVRSAudioDecoder::DecodeAudioBytesInternal(const TArray<uint8>& AudioData, FVRSDecodedWav& OutDecoded)
+{
+    if (VRSOpus::IsOggOpus(AudioData))
     {
-        // Read chunk ID
-        if (WavData[Offset] == 'd' && WavData[Offset + 1] == 'a' && 
-            WavData[Offset + 2] == 't' && WavData[Offset + 3] == 'a')
+        if (!VRSOpus::Decode(AudioData, OutDecoded))
         {
-            // Found data chunk
-            OutDataSize = ReadInt32(WavData, Offset + 4);
-            OutDataOffset = Offset + 8;
-            FoundData = true;
-            break;
+            return false;
         }
-
-        // Skip this chunk
-        const int32 ChunkSize = ReadInt32(WavData, Offset + 4);
-        Offset += 8 + ChunkSize;
+        ResampleToDeviceRate(OutDecoded);
+        return true;
     }
+    return DecodeWavBytesInternal(AudioData, OutDecoded);
+}
 
-    if (!FoundData)
+bool UVRSAudioDecoder::DecodeAudioBytesInternal(TArray<uint8>&& AudioData, FVRSDecodedWav& OutDecoded)
+{
+    if (VRSOpus::IsOggOpus(AudioData))
     {
-        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Invalid WAV: Missing data chunk"));
-        return false;
+        // Opus depacketizes into its own buffer; the compressed input is
+        // recycled rather than adopted.
+        const bool bOk = VRSOpus::Decode(AudioData, OutDecoded);
+        FVRSAudioBufferPool::Get().Release(MoveTemp(AudioData));
+        if (!bOk)
+        {
+            return false;
+        }
+        ResampleToDeviceRate(OutDecoded);
+        return true;
     }
-
-    return true;
+    return DecodeWavBytesInternal(MoveTemp(AudioData), OutDecoded);
 }
 
-int32 UVRSAudioDecoder::ReadInt32(const TArray<uint8>& Data, int32 Offset)
+void UVRSAudioDecoder::ResampleToDeviceRate(FVRSDecodedWav& Decoded)
 {
-    if (Offset + 4 > Data.Num())
+    // Match the mixer's output rate once here instead of paying per-frame
+    // mixer resampling for every playing instance. A rate of 0 (device not
+    // yet queried from the game thread) or a failed resample leaves the
+    // audio at its source rate, which the mixer handles as before.
+    const int32 DeviceRate = VRSAudioResample::GetCachedDeviceSampleRate();
+    if (DeviceRate > 0 && DeviceRate != Decoded.SampleRate)
     {
-        return 0;
+        VRSAudioResample::ResampleDecoded(Decoded, DeviceRate);
     }
-
-    // Little-endian read
-    return (int32)Data[Offset] |
-           ((int32)Data[Offset + 1] << 8) |
-           ((int32)Data[Offset + 2] << 16) |
-           ((int32)Data[Offset + 3] << 24);
 }
 
-int16 UVRSAudioDecoder::ReadInt16(const TArray<uint8>& Data, int32 Offset)
+USoundWave* UVRSAudioDecoder::CreateSoundWaveFromDecoded(FVRSDecodedWav&& Decoded)
 {
-    if (Offset + 2 > Data.Num())
+    check(IsInGameThread());
+
+    const int32 DataSize = Decoded.GetPcmNumBytes();
+
+    // Step 4: Create USoundWave
+    USoundWave* SoundWave = NewObject<USoundWave>(GetTransientPackage(), NAME_None, RF_Transient);
+    if (!SoundWave)
     {
-        return 0;
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Failed to create USoundWave object"));
+        FVRSAudioBufferPool::Get().Release(MoveTemp(Decoded.Backing));
+        return nullptr;
     }
 
-    // Little-endian read
-    return (int16)Data[Offset] | ((int16)Data[Offset + 1] << 8);
-}
\ No newline at end of file
+    // Step 5: Configure SoundWave properties
+    SoundWave->SetSampleRate(Decoded.SampleRate);
+    SoundWave->NumChannels = Decoded.NumChannels;
+    SoundWave->Duration = (float)DataSize / (float)(Decoded.SampleRate * Decoded.NumChannels * 2); // 2 bytes per sample (16-bit)
+    SoundWave->RawPCMDataSize = DataSize;
+    SoundWave->SoundGroup = SOUNDGROUP_Default;
+
+    // Step 6: Hand the PCM data to the SoundWave. RawPCMData must stay a
+    // plain FMemory::Malloc block — the engine frees it itself when the
+    // USoundWave dies, so it cannot come from the pool.
+    SoundWave->RawPCMData = (uint8*)FMemory::Malloc(DataSize);
+    if (!SoundWave->RawPCMData)
+    {
+        UE_LOG(LogVRSAudioDecoder, Error, TEXT("Failed to allocate %d bytes for PCM data"), DataSize);
+        FVRSAudioBufferPool::Get().Release(MoveTemp(Decoded.Backing));
+        return nullptr;
+    }
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_PcmCopy);
+        CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, PcmCopy);
+
+        FMemory::Memcpy(SoundWave->RawPCMData, Decoded.GetPcmData(), DataSize);
+    }
+    FVRSAudioBufferPool::Get().Release(MoveTemp(Decoded.Backing));
+
+    // Step 7: Finalize SoundWave
+    SoundWave->InvalidateCompressedData();
+
+    UE_LOG(LogVRSAudioDecoder, Log,
+           TEXT("Successfully created SoundWave: %.2f seconds, %d Hz, %d channels"),
+           SoundWave->Duration, Decoded.SampleRate, Decoded.NumChannels);
+
+    return SoundWave;
+}
+
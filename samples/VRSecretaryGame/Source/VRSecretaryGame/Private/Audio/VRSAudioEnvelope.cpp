@@ -0,0 +1,150 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSAudioEnvelope.h"
+#include "Audio/VRSAudioStats.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+    #include <emmintrin.h> // SSE2
+    #define VRS_ENVELOPE_SIMD_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+    #include <arm_neon.h>
+    #define VRS_ENVELOPE_SIMD_NEON 1
+#endif
+
+namespace
+{
+    constexpr float InvFullScale = 1.0f / 32768.0f;
+
+#if VRS_ENVELOPE_SIMD_SSE2
+
+    /** Unsigned 16-bit lane max (SSE2 only has the signed form). */
+    FORCEINLINE __m128i MaxU16(__m128i A, __m128i B)
+    {
+        return _mm_add_epi16(_mm_subs_epu16(A, B), B);
+    }
+
+    /**
+     * Accumulate 8 samples into the running sum-of-squares (4 float lanes)
+     * and the running peak (8 uint16 lanes of |sample|).
+     */
+    FORCEINLINE void AccumulateSse2(__m128i In, __m128& SumSq, __m128i& PeakU16)
+    {
+        // abs(-32768) stays 0x8000, which reads back as 32768 in the
+        // unsigned peak lanes — exactly the magnitude we want.
+        const __m128i Neg = _mm_sub_epi16(_mm_setzero_si128(), In);
+        const __m128i Abs = _mm_max_epi16(In, Neg);
+        PeakU16 = MaxU16(PeakU16, Abs);
+
+        // pmaddwd can't square here: a pair of -32768 samples wraps its
+        // int32 lane to INT32_MIN (the instruction's one overflow case) and
+        // hard-clipped audio would drive the window RMS negative. Widen to
+        // sign-extended 32-bit lanes and square in float, like the NEON path
+        // widens through vmull.
+        const __m128i LoI32 = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), In), 16);
+        const __m128i HiI32 = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), In), 16);
+        const __m128 LoF = _mm_cvtepi32_ps(LoI32);
+        const __m128 HiF = _mm_cvtepi32_ps(HiI32);
+        SumSq = _mm_add_ps(SumSq, _mm_mul_ps(LoF, LoF));
+        SumSq = _mm_add_ps(SumSq, _mm_mul_ps(HiF, HiF));
+    }
+
+#elif VRS_ENVELOPE_SIMD_NEON
+
+    FORCEINLINE void AccumulateNeon(int16x8_t In, float32x4_t& SumSq, uint16x8_t& PeakU16)
+    {
+        const uint16x8_t Abs = vreinterpretq_u16_s16(vabsq_s16(In));
+        PeakU16 = vmaxq_u16(PeakU16, Abs);
+
+        const int32x4_t SqLo = vmull_s16(vget_low_s16(In), vget_low_s16(In));
+        const int32x4_t SqHi = vmull_s16(vget_high_s16(In), vget_high_s16(In));
+        SumSq = vaddq_f32(SumSq, vcvtq_f32_s32(SqLo));
+        SumSq = vaddq_f32(SumSq, vcvtq_f32_s32(SqHi));
+    }
+
+#endif
+
+    /** RMS + peak over one window of interleaved samples. */
+    void MeasureWindow(const int16* Samples, int32 Count, float& OutRms, float& OutPeak)
+    {
+        float SumSquares = 0.0f;
+        int32 PeakAbs = 0;
+        int32 Index = 0;
+
+#if VRS_ENVELOPE_SIMD_SSE2
+        __m128 SumVec = _mm_setzero_ps();
+        __m128i PeakVec = _mm_setzero_si128();
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            const __m128i In = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Samples + Index));
+            AccumulateSse2(In, SumVec, PeakVec);
+        }
+
+        alignas(16) float SumLanes[4];
+        _mm_store_ps(SumLanes, SumVec);
+        SumSquares = SumLanes[0] + SumLanes[1] + SumLanes[2] + SumLanes[3];
+
+        alignas(16) uint16 PeakLanes[8];
+        _mm_store_si128(reinterpret_cast<__m128i*>(PeakLanes), PeakVec);
+        for (const uint16 Lane : PeakLanes)
+        {
+            PeakAbs = FMath::Max(PeakAbs, (int32)Lane);
+        }
+#elif VRS_ENVELOPE_SIMD_NEON
+        float32x4_t SumVec = vdupq_n_f32(0.0f);
+        uint16x8_t PeakVec = vdupq_n_u16(0);
+        for (; Index + 8 <= Count; Index += 8)
+        {
+            AccumulateNeon(vld1q_s16(Samples + Index), SumVec, PeakVec);
+        }
+
+        SumSquares = vgetq_lane_f32(SumVec, 0) + vgetq_lane_f32(SumVec, 1) +
+                     vgetq_lane_f32(SumVec, 2) + vgetq_lane_f32(SumVec, 3);
+        PeakAbs = (int32)vmaxvq_u16(PeakVec);
+#endif
+
+        for (; Index < Count; ++Index)
+        {
+            const int32 Sample = Samples[Index];
+            SumSquares += (float)(Sample * Sample);
+            PeakAbs = FMath::Max(PeakAbs, FMath::Abs(Sample));
+        }
+
+        OutRms = Count > 0 ? FMath::Sqrt(SumSquares / (float)Count) * InvFullScale : 0.0f;
+        OutPeak = (float)PeakAbs * InvFullScale;
+    }
+}
+
+namespace VRSAudioEnvelope
+{
+
+void Compute(const int16* Samples, int32 NumSamples, int32 NumChannels,
+             int32 SampleRate, float WindowMs, FVRSLipSyncEnvelope& OutEnvelope)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VRSecretary_EnvelopeExtract);
+    CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, EnvelopeExtract);
+
+    OutEnvelope = FVRSLipSyncEnvelope();
+
+    if (!Samples || NumSamples <= 0 || NumChannels <= 0 || SampleRate <= 0)
+    {
+        return;
+    }
+
+    WindowMs = FMath::Clamp(WindowMs, 1.0f, 1000.0f);
+    const int32 WindowFrames = FMath::Max(1, FMath::RoundToInt((float)SampleRate * WindowMs / 1000.0f));
+    const int32 WindowSamples = WindowFrames * NumChannels;
+    const int32 NumWindows = FMath::DivideAndRoundUp(NumSamples, WindowSamples);
+
+    OutEnvelope.WindowSeconds = (float)WindowFrames / (float)SampleRate;
+    OutEnvelope.RMS.SetNumUninitialized(NumWindows);
+    OutEnvelope.Peak.SetNumUninitialized(NumWindows);
+
+    for (int32 Window = 0; Window < NumWindows; ++Window)
+    {
+        const int32 Start = Window * WindowSamples;
+        const int32 Count = FMath::Min(WindowSamples, NumSamples - Start);
+        MeasureWindow(Samples + Start, Count, OutEnvelope.RMS[Window], OutEnvelope.Peak[Window]);
+    }
+}
+
+} // namespace VRSAudioEnvelope
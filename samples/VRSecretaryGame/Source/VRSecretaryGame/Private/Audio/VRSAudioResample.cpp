@@ -0,0 +1,115 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSAudioResample.h"
+
+#include "Audio/VRSAudioBufferPool.h"
+#include "Audio/VRSAudioDecoder.h"
+#include "Audio/VRSAudioStats.h"
+#include "AudioDevice.h"
+#include "DSP/AudioResampler.h"
+#include "DSP/FloatArrayMath.h"
+#include "Engine/Engine.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRSAudioResample, Log, All);
+
+namespace
+{
+    std::atomic<int32> CachedDeviceSampleRate{0};
+}
+
+int32 VRSAudioResample::GetCachedDeviceSampleRate()
+{
+    int32 Rate = CachedDeviceSampleRate.load(std::memory_order_relaxed);
+    if (Rate > 0)
+    {
+        return Rate;
+    }
+
+    // The audio device is only safely reachable from the game thread; task
+    // graph callers just get whatever an earlier game-thread call cached.
+    if (!IsInGameThread() || !GEngine)
+    {
+        return 0;
+    }
+
+    if (FAudioDeviceHandle Device = GEngine->GetMainAudioDevice())
+    {
+        Rate = (int32)Device->GetSampleRate();
+        if (Rate > 0)
+        {
+            CachedDeviceSampleRate.store(Rate, std::memory_order_relaxed);
+        }
+    }
+    return Rate;
+}
+
+bool VRSAudioResample::ResampleDecoded(FVRSDecodedWav& Decoded, int32 TargetSampleRate)
+{
+    if (TargetSampleRate <= 0 || Decoded.SampleRate == TargetSampleRate)
+    {
+        return true;
+    }
+
+    const int32 NumSamples = Decoded.GetPcmNumBytes() / (int32)sizeof(int16);
+    if (NumSamples == 0 || Decoded.NumChannels <= 0)
+    {
+        return true;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_VRSecretary_PcmResample);
+    CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, PcmResample);
+
+    // int16 → float with the engine's vectorized array math. The float
+    // buffers are transient and aligned for SIMD, so they can't come from
+    // the byte pool; this runs on the task graph where the two short-lived
+    // allocations don't hitch the frame.
+    Audio::FAlignedFloatBuffer FloatInput;
+    FloatInput.SetNumUninitialized(NumSamples);
+    Audio::ArrayPcm16ToFloat(
+        MakeArrayView((const int16*)Decoded.GetPcmData(), NumSamples),
+        MakeArrayView(FloatInput.GetData(), NumSamples));
+
+    const Audio::FResamplingParameters Params = {
+        Audio::EResamplingMethod::BestSinc,
+        Decoded.NumChannels,
+        (float)Decoded.SampleRate,
+        (float)TargetSampleRate,
+        FloatInput,
+    };
+
+    Audio::FAlignedFloatBuffer FloatOutput;
+    FloatOutput.AddUninitialized(Audio::GetOutputBufferSize(Params));
+
+    Audio::FResamplerResults Results;
+    Results.OutBuffer = &FloatOutput;
+
+    if (!Audio::Resample(Params, Results) || Results.OutputFramesGenerated <= 0)
+    {
+        UE_LOG(LogVRSAudioResample, Warning,
+               TEXT("Resample %d Hz -> %d Hz failed; keeping source rate"),
+               Decoded.SampleRate, TargetSampleRate);
+        return false;
+    }
+
+    const int32 OutSamples = Results.OutputFramesGenerated * Decoded.NumChannels;
+    const int32 OutBytes = OutSamples * (int32)sizeof(int16);
+
+    TArray<uint8> OutPcm = FVRSAudioBufferPool::Get().Acquire(OutBytes);
+    OutPcm.SetNumUninitialized(OutBytes);
+    Audio::ArrayFloatToPcm16(
+        MakeArrayView(FloatOutput.GetData(), OutSamples),
+        MakeArrayView((int16*)OutPcm.GetData(), OutSamples));
+
+    FVRSAudioBufferPool::Get().Release(MoveTemp(Decoded.Backing));
+    Decoded.AdoptWholeBuffer(MoveTemp(OutPcm));
+
+    UE_LOG(LogVRSAudioResample, Verbose,
+           TEXT("Resampled %d Hz -> %d Hz (%d -> %d frames)"),
+           Decoded.SampleRate, TargetSampleRate,
+           NumSamples / Decoded.NumChannels, Results.OutputFramesGenerated);
+
+    Decoded.SampleRate = TargetSampleRate;
+    return true;
+}
@@ -0,0 +1,35 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FVRSDecodedWav;
+
+/**
+ * One-shot resample of decoded TTS audio to the mixer's output rate.
+ *
+ * TTS voices come out at 22.05 or 24 kHz while the device mixes at 48 kHz,
+ * so every playing instance would otherwise pay per-frame mixer resampling
+ * for its whole lifetime. Converting once at decode time — int16 → float,
+ * engine resampler (vectorized per platform), float → int16 — moves that
+ * cost to a single background-thread pass and lets the mixer copy samples
+ * straight through.
+ */
+namespace VRSAudioResample
+{
+    /**
+     * The mixer output sample rate, cached on first query. Must first be
+     * called on the game thread (the decoder's entry points prime it before
+     * going async); returns 0 while unknown, which disables resampling.
+     */
+    int32 GetCachedDeviceSampleRate();
+
+    /**
+     * Resample Decoded in place to TargetSampleRate, updating its PCM and
+     * SampleRate. No-op when the rates already match. On failure the
+     * original audio is left untouched (the mixer then resamples as before).
+     * Touches no UObjects; safe on any thread.
+     */
+    bool ResampleDecoded(FVRSDecodedWav& Decoded, int32 TargetSampleRate);
+}
@@ -0,0 +1,12 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSAudioStats.h"
+
+DEFINE_STAT(STAT_VRSecretary_Base64Decode);
+DEFINE_STAT(STAT_VRSecretary_WavParse);
+DEFINE_STAT(STAT_VRSecretary_PcmCopy);
+DEFINE_STAT(STAT_VRSecretary_PcmResample);
+DEFINE_STAT(STAT_VRSecretary_OpusDecode);
+DEFINE_STAT(STAT_VRSecretary_EnvelopeExtract);
+
+CSV_DEFINE_CATEGORY(VRSecretaryAudio, true);
@@ -0,0 +1,36 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Decode-side timings for the VRSecretary pipeline. Declares the same
+ * "VRSecretary" stat group as the plugin module (the stats system merges
+ * groups by name), so `stat VRSecretary` shows request and decode stages
+ * side by side. CSV counters go to their own "VRSecretaryAudio" category
+ * since CSV categories must be defined by exactly one module.
+ */
+DECLARE_STATS_GROUP(TEXT("VRSecretary"), STATGROUP_VRSecretary, STATCAT_Advanced);
+
+/** CPU time spent base64-decoding the WAV payload. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Base64 Decode"), STAT_VRSecretary_Base64Decode, STATGROUP_VRSecretary, );
+
+/** CPU time spent parsing the WAV header and locating the data chunk. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("WAV Parse"), STAT_VRSecretary_WavParse, STATGROUP_VRSecretary, );
+
+/** CPU time spent copying PCM into staging and sound-wave buffers. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PCM Copy"), STAT_VRSecretary_PcmCopy, STATGROUP_VRSecretary, );
+
+/** CPU time spent converting and resampling PCM to the device rate. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PCM Resample"), STAT_VRSecretary_PcmResample, STATGROUP_VRSecretary, );
+
+/** CPU time spent depacketizing and decoding Ogg Opus audio. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Opus Decode"), STAT_VRSecretary_OpusDecode, STATGROUP_VRSecretary, );
+
+/** CPU time spent extracting the lip-sync envelope from decoded PCM. */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Envelope Extract"), STAT_VRSecretary_EnvelopeExtract, STATGROUP_VRSecretary, );
+
+CSV_DECLARE_CATEGORY_EXTERN(VRSecretaryAudio);
@@ -0,0 +1,263 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSBase64.h"
+#include "Audio/VRSAudioStats.h"
+#include "Misc/Base64.h"
+
+// The block loops reinterpret TCHAR buffers as uint16 lanes, so they are
+// compiled out on platforms with 4-byte TCHARs.
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_TCHAR_IS_4_BYTES
+    #include <tmmintrin.h> // SSSE3
+    #define VRS_BASE64_SIMD_SSSE3 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON && !PLATFORM_TCHAR_IS_4_BYTES
+    #include <arm_neon.h>
+    #define VRS_BASE64_SIMD_NEON 1
+#endif
+
+namespace
+{
+    /** Below this size the SIMD setup isn't worth it; FBase64 handles it. */
+    constexpr int32 SimdThresholdChars = 4096;
+
+    /** 0xFF = invalid character; otherwise the 6-bit value. */
+    const uint8* GetScalarDecodeTable()
+    {
+        static uint8 Table[256];
+        static bool bInitialized = false;
+        if (!bInitialized)
+        {
+            FMemory::Memset(Table, 0xFF, sizeof(Table));
+            for (int32 Index = 0; Index < 26; ++Index)
+            {
+                Table['A' + Index] = (uint8)Index;
+                Table['a' + Index] = (uint8)(26 + Index);
+            }
+            for (int32 Index = 0; Index < 10; ++Index)
+            {
+                Table['0' + Index] = (uint8)(52 + Index);
+            }
+            Table['+'] = 62;
+            Table['/'] = 63;
+            bInitialized = true;
+        }
+        return Table;
+    }
+
+    /**
+     * Decode the final (<= 20) characters, including '=' padding. Returns
+     * false on any invalid character.
+     */
+    bool DecodeScalarTail(const TCHAR* Src, int32 Len, TArray<uint8>& Out)
+    {
+        const uint8* Table = GetScalarDecodeTable();
+
+        // Strip padding (at most two '=').
+        int32 Padding = 0;
+        while (Len > 0 && Src[Len - 1] == TEXT('='))
+        {
+            --Len;
+            ++Padding;
+        }
+        if (Padding > 2 || (Len + Padding) % 4 != 0)
+        {
+            return false;
+        }
+
+        uint32 Accumulator = 0;
+        int32 BitsCollected = 0;
+        for (int32 Index = 0; Index < Len; ++Index)
+        {
+            const TCHAR Char = Src[Index];
+            if (Char > 0xFF)
+            {
+                return false;
+            }
+            const uint8 Value = Table[(uint8)Char];
+            if (Value == 0xFF)
+            {
+                return false;
+            }
+            Accumulator = (Accumulator << 6) | Value;
+            BitsCollected += 6;
+            if (BitsCollected >= 8)
+            {
+                BitsCollected -= 8;
+                Out.Add((uint8)((Accumulator >> BitsCollected) & 0xFF));
+            }
+        }
+        return true;
+    }
+
+#if VRS_BASE64_SIMD_SSSE3
+
+    /**
+     * Decode 16 base64 characters into 12 bytes (W. Mula's SSSE3 algorithm).
+     * Returns false if any character is outside the base64 alphabet.
+     */
+    FORCEINLINE bool DecodeBlockSsse3(__m128i In, uint8* Out)
+    {
+        const __m128i LutLo = _mm_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i LutHi = _mm_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m128i LutRoll = _mm_setr_epi8(
+            0, 16, 19, 4, -65, -65, -71, -71,
+            0, 0, 0, 0, 0, 0, 0, 0);
+
+        const __m128i Mask0F = _mm_set1_epi8(0x0F);
+        const __m128i Mask2F = _mm_set1_epi8(0x2F);
+
+        const __m128i HiNibbles = _mm_and_si128(_mm_srli_epi32(In, 4), Mask0F);
+        const __m128i LoNibbles = _mm_and_si128(In, Mask0F);
+        const __m128i Lo = _mm_shuffle_epi8(LutLo, LoNibbles);
+        const __m128i Hi = _mm_shuffle_epi8(LutHi, HiNibbles);
+        const __m128i EqSlash = _mm_cmpeq_epi8(In, Mask2F);
+        const __m128i Roll = _mm_shuffle_epi8(LutRoll, _mm_add_epi8(EqSlash, HiNibbles));
+
+        // Any non-alphabet character classifies to a nonzero (lo & hi) byte.
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(Lo, Hi), _mm_setzero_si128())) != 0)
+        {
+            return false;
+        }
+
+        const __m128i Values = _mm_add_epi8(In, Roll);
+
+        // Pack 16 x 6-bit fields into 12 bytes.
+        const __m128i MergeAB_BC = _mm_maddubs_epi16(Values, _mm_set1_epi32(0x01400140));
+        const __m128i Merged = _mm_madd_epi16(MergeAB_BC, _mm_set1_epi32(0x00011000));
+        const __m128i Shuffled = _mm_shuffle_epi8(Merged, _mm_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        // Store 12 bytes (8 + 4, staying SSSE3-only).
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(Out), Shuffled);
+        const int32 Tail = _mm_cvtsi128_si32(_mm_srli_si128(Shuffled, 8));
+        FMemory::Memcpy(Out + 8, &Tail, 4);
+        return true;
+    }
+
+#elif VRS_BASE64_SIMD_NEON
+
+    /** NEON variant of the 16-chars-to-12-bytes block decode. */
+    FORCEINLINE bool DecodeBlockNeon(uint8x16_t In, uint8* Out)
+    {
+        const uint8_t LutLoBytes[16] = {
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A };
+        const uint8_t LutHiBytes[16] = {
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 };
+        const uint8_t LutRollBytes[16] = {
+            0, 16, 19, 4, (uint8_t)-65, (uint8_t)-65, (uint8_t)-71, (uint8_t)-71,
+            0, 0, 0, 0, 0, 0, 0, 0 };
+
+        const uint8x16_t LutLo = vld1q_u8(LutLoBytes);
+        const uint8x16_t LutHi = vld1q_u8(LutHiBytes);
+        const uint8x16_t LutRoll = vld1q_u8(LutRollBytes);
+
+        const uint8x16_t HiNibbles = vshrq_n_u8(In, 4);
+        const uint8x16_t LoNibbles = vandq_u8(In, vdupq_n_u8(0x0F));
+        const uint8x16_t Lo = vqtbl1q_u8(LutLo, LoNibbles);
+        const uint8x16_t Hi = vqtbl1q_u8(LutHi, HiNibbles);
+        const uint8x16_t EqSlash = vceqq_u8(In, vdupq_n_u8(0x2F));
+        const uint8x16_t Roll = vqtbl1q_u8(LutRoll, vaddq_u8(EqSlash, HiNibbles));
+
+        if (vmaxvq_u8(vandq_u8(Lo, Hi)) != 0)
+        {
+            return false;
+        }
+
+        const uint8x16_t Values = vaddq_u8(In, Roll);
+
+        // Pack 16 x 6-bit fields into 12 bytes: pairwise (c0<<6|c1), then
+        // (pair0<<12|pair1), then reorder the three payload bytes per lane.
+        const uint16x8_t Lanes16 = vreinterpretq_u16_u8(Values);
+        const uint16x8_t Even = vandq_u16(Lanes16, vdupq_n_u16(0x00FF));
+        const uint16x8_t Odd = vshrq_n_u16(Lanes16, 8);
+        const uint16x8_t Pairs = vorrq_u16(vshlq_n_u16(Even, 6), Odd);
+
+        const uint32x4_t Lanes32 = vreinterpretq_u32_u16(Pairs);
+        const uint32x4_t PairEven = vandq_u32(Lanes32, vdupq_n_u32(0x0000FFFF));
+        const uint32x4_t PairOdd = vshrq_n_u32(Lanes32, 16);
+        const uint32x4_t Merged = vorrq_u32(vshlq_n_u32(PairEven, 12), PairOdd);
+
+        const uint8_t ShuffleBytes[16] = {
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 255, 255, 255, 255 };
+        const uint8x16_t Shuffled = vqtbl1q_u8(vreinterpretq_u8_u32(Merged), vld1q_u8(ShuffleBytes));
+
+        uint8_t Staging[16];
+        vst1q_u8(Staging, Shuffled);
+        FMemory::Memcpy(Out, Staging, 12);
+        return true;
+    }
+
+#endif
+}
+
+namespace VRSBase64
+{
+    bool Decode(const FString& Source, TArray<uint8>& OutBytes)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VRSecretary_Base64Decode);
+        CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, Base64Decode);
+
+#if VRS_BASE64_SIMD_SSSE3 || VRS_BASE64_SIMD_NEON
+        const int32 Len = Source.Len();
+        if (Len < SimdThresholdChars)
+        {
+            return FBase64::Decode(Source, OutBytes);
+        }
+        if (Len % 4 != 0)
+        {
+            return false;
+        }
+
+        const TCHAR* Src = *Source;
+
+        OutBytes.Reset();
+        OutBytes.Reserve(Len / 4 * 3);
+
+        // Leave the last 32 characters (which may contain '=' padding) to the
+        // scalar tail; everything before is guaranteed pure alphabet or error.
+        int32 CharsLeft = Len;
+        while (CharsLeft > 32)
+        {
+            const int32 OutOffset = OutBytes.Num();
+            OutBytes.AddUninitialized(12);
+
+#if VRS_BASE64_SIMD_SSSE3
+            // Narrow 16 TCHARs to 16 bytes; saturation turns any non-Latin1
+            // character into 0xFF, which fails classification below.
+            const __m128i Wide0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src));
+            const __m128i Wide1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + 8));
+            const __m128i In = _mm_packus_epi16(Wide0, Wide1);
+            const bool bBlockOk = DecodeBlockSsse3(In, OutBytes.GetData() + OutOffset);
+#else
+            const uint16x8_t Wide0 = vld1q_u16(reinterpret_cast<const uint16_t*>(Src));
+            const uint16x8_t Wide1 = vld1q_u16(reinterpret_cast<const uint16_t*>(Src + 8));
+            // vqmovn saturates like packus, so wide characters fail validation.
+            const uint8x16_t In = vcombine_u8(vqmovn_u16(Wide0), vqmovn_u16(Wide1));
+            const bool bBlockOk = DecodeBlockNeon(In, OutBytes.GetData() + OutOffset);
+#endif
+            if (!bBlockOk)
+            {
+                // Unexpected character mid-stream: let FBase64 produce the
+                // exact legacy accept/reject result.
+                return FBase64::Decode(Source, OutBytes);
+            }
+
+            Src += 16;
+            CharsLeft -= 16;
+        }
+
+        if (!DecodeScalarTail(Src, CharsLeft, OutBytes))
+        {
+            return FBase64::Decode(Source, OutBytes);
+        }
+        return true;
+#else
+        return FBase64::Decode(Source, OutBytes);
+#endif
+    }
+}
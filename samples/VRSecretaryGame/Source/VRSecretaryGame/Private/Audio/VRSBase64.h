@@ -0,0 +1,26 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Vectorized base64 decoding for large audio payloads.
+ *
+ * FBase64::Decode is a scalar byte-at-a-time loop and shows up as the hottest
+ * function in the response path when many NPCs decode multi-hundred-KB TTS
+ * replies. Decode() below processes 16 input characters per iteration with
+ * SSSE3 on x86 or NEON on ARM (Quest), falling back to FBase64 for small
+ * inputs, platforms without vector intrinsics, or inputs containing anything
+ * outside the strict base64 alphabet.
+ */
+namespace VRSBase64
+{
+    /**
+     * Decode a base64 string into OutBytes. Drop-in replacement for
+     * FBase64::Decode with identical accept/reject behaviour.
+     *
+     * @return true on success; OutBytes holds the decoded payload
+     */
+    bool Decode(const FString& Source, TArray<uint8>& OutBytes);
+}
@@ -0,0 +1,188 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSOpusDecoder.h"
+#include "Audio/VRSAudioBufferPool.h"
+#include "Audio/VRSAudioDecoder.h"
+#include "Audio/VRSAudioStats.h"
+
+#if VRS_WITH_OPUS
+THIRD_PARTY_INCLUDES_START
+#include "opus.h"
+THIRD_PARTY_INCLUDES_END
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRSOpusDecoder, Log, All);
+
+namespace
+{
+    /** Opus always decodes at its native rate. */
+    constexpr int32 OpusSampleRate = 48000;
+
+    /** Largest legal Opus frame: 120 ms at 48 kHz, per channel. */
+    constexpr int32 MaxFrameSamples = 5760;
+}
+
+bool VRSOpus::IsOggOpus(const TArray<uint8>& Data)
+{
+    return Data.Num() >= 4 &&
+           Data[0] == (uint8)'O' && Data[1] == (uint8)'g' &&
+           Data[2] == (uint8)'g' && Data[3] == (uint8)'S';
+}
+
+#if VRS_WITH_OPUS
+
+bool VRSOpus::Decode(const TArray<uint8>& OggData, FVRSDecodedWav& OutDecoded)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VRSecretary_OpusDecode);
+    CSV_SCOPED_TIMING_STAT(VRSecretaryAudio, OpusDecode);
+
+    if (!IsOggOpus(OggData))
+    {
+        UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: not an Ogg stream"));
+        return false;
+    }
+
+    OpusDecoder* Decoder = nullptr;
+    int32 Channels = 0;
+    int32 SkipSamples = 0;    // Pre-skip from OpusHead, trimmed off the front.
+    int32 PacketIndex = 0;
+    bool bOk = true;
+
+    // Opus compresses voice ~10x; oversize the guess slightly so typical
+    // clips decode without the pool buffer regrowing.
+    OutDecoded.Backing = FVRSAudioBufferPool::Get().Acquire(OggData.Num() * 12);
+    OutDecoded.Backing.Reset();
+
+    TArray<int16> Frame;
+    TArray<uint8> Packet;
+
+    // Walk the Ogg pages: 27-byte header, segment table, then the packet
+    // bytes. A 255 lacing value means the packet continues in the next
+    // segment (possibly on the next page).
+    int32 Offset = 0;
+    while (bOk && Offset + 27 <= OggData.Num())
+    {
+        if (OggData[Offset] != (uint8)'O' || OggData[Offset + 1] != (uint8)'g' ||
+            OggData[Offset + 2] != (uint8)'g' || OggData[Offset + 3] != (uint8)'S')
+        {
+            UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: lost page sync at offset %d"), Offset);
+            bOk = false;
+            break;
+        }
+
+        const int32 SegCount = OggData[Offset + 26];
+        int32 Body = Offset + 27 + SegCount;
+        if (Body > OggData.Num())
+        {
+            UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: truncated page header"));
+            bOk = false;
+            break;
+        }
+
+        for (int32 Seg = 0; Seg < SegCount && bOk; ++Seg)
+        {
+            const int32 SegLen = OggData[Offset + 27 + Seg];
+            if (Body + SegLen > OggData.Num())
+            {
+                UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: truncated packet data"));
+                bOk = false;
+                break;
+            }
+            Packet.Append(OggData.GetData() + Body, SegLen);
+            Body += SegLen;
+            if (SegLen == 255)
+            {
+                continue; // Packet spans into the next segment.
+            }
+
+            // Packet complete.
+            if (PacketIndex == 0)
+            {
+                // OpusHead: magic, version, channels, pre-skip (LE16).
+                if (Packet.Num() < 19 ||
+                    FMemory::Memcmp(Packet.GetData(), "OpusHead", 8) != 0)
+                {
+                    UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: missing OpusHead"));
+                    bOk = false;
+                    break;
+                }
+                Channels = Packet[9];
+                SkipSamples = (int32)Packet[10] | ((int32)Packet[11] << 8);
+                if (Channels < 1 || Channels > 2)
+                {
+                    UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: unsupported channel count %d"), Channels);
+                    bOk = false;
+                    break;
+                }
+
+                int32 OpusError = OPUS_OK;
+                Decoder = opus_decoder_create(OpusSampleRate, Channels, &OpusError);
+                if (!Decoder || OpusError != OPUS_OK)
+                {
+                    UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: opus_decoder_create failed (%d)"), OpusError);
+                    bOk = false;
+                    break;
+                }
+                Frame.SetNumUninitialized(MaxFrameSamples * Channels);
+            }
+            else if (PacketIndex >= 2 && Decoder)
+            {
+                // Packet 1 is OpusTags (skipped); the rest is audio.
+                const int32 Samples = opus_decode(Decoder, Packet.GetData(), Packet.Num(),
+                                                  Frame.GetData(), MaxFrameSamples, 0);
+                if (Samples < 0)
+                {
+                    UE_LOG(LogVRSOpusDecoder, Error, TEXT("Decode: opus_decode failed (%d)"), Samples);
+                    bOk = false;
+                    break;
+                }
+
+                const int32 Trim = FMath::Min(SkipSamples, Samples);
+                SkipSamples -= Trim;
+                const int32 Kept = Samples - Trim;
+                if (Kept > 0)
+                {
+                    OutDecoded.Backing.Append(
+                        (const uint8*)(Frame.GetData() + Trim * Channels),
+                        Kept * Channels * (int32)sizeof(int16));
+                }
+            }
+            ++PacketIndex;
+            Packet.Reset();
+        }
+
+        Offset = Body;
+    }
+
+    if (Decoder)
+    {
+        opus_decoder_destroy(Decoder);
+    }
+
+    if (!bOk || OutDecoded.Backing.Num() == 0)
+    {
+        FVRSAudioBufferPool::Get().Release(MoveTemp(OutDecoded.Backing));
+        return false;
+    }
+
+    OutDecoded.SampleRate = OpusSampleRate;
+    OutDecoded.NumChannels = Channels;
+    OutDecoded.PcmOffset = 0;
+    OutDecoded.PcmNumBytes = OutDecoded.Backing.Num();
+
+    UE_LOG(LogVRSOpusDecoder, Verbose,
+           TEXT("Decoded Ogg Opus: %d bytes -> %d PCM bytes, %d channels"),
+           OggData.Num(), OutDecoded.Backing.Num(), Channels);
+    return true;
+}
+
+#else // !VRS_WITH_OPUS
+
+bool VRSOpus::Decode(const TArray<uint8>& OggData, FVRSDecodedWav& OutDecoded)
+{
+    UE_LOG(LogVRSOpusDecoder, Error,
+           TEXT("Decode: Opus support not compiled in on this platform (VRS_WITH_OPUS=0)"));
+    return false;
+}
+
+#endif // VRS_WITH_OPUS
@@ -0,0 +1,33 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FVRSDecodedWav;
+
+/**
+ * Ogg Opus decoding for compressed TTS audio.
+ *
+ * Opus cuts the audio payload roughly tenfold against 16-bit PCM WAV at the
+ * same voice quality, which matters on cellular-connected deployments. The
+ * gateway wraps Opus packets in a standard Ogg container (RFC 7845); this is
+ * a minimal single-stream depacketizer feeding the engine's bundled libopus —
+ * chained streams and seeking are out of scope for short TTS clips.
+ *
+ * Compiled out (every call fails with a log) when VRS_WITH_OPUS is 0, i.e. on
+ * platforms where the build script doesn't pull in the libOpus third-party
+ * library.
+ */
+namespace VRSOpus
+{
+    /** True when the buffer starts with the Ogg capture pattern ("OggS"). */
+    bool IsOggOpus(const TArray<uint8>& Data);
+
+    /**
+     * Decode a complete Ogg Opus clip to interleaved 16-bit PCM at 48 kHz
+     * (the codec's native rate). Thread-safe; touches no UObjects. The PCM
+     * buffer is acquired from FVRSAudioBufferPool like the WAV path's.
+     */
+    bool Decode(const TArray<uint8>& OggData, FVRSDecodedWav& OutDecoded);
+}
@@ -0,0 +1,80 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSProceduralWavStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRSProceduralWavStream, Log, All);
+
+bool UVRSProceduralWavStream::AppendAudioBytes(const TArray<uint8>& Chunk)
+{
+    if (bFailed)
+    {
+        return false;
+    }
+
+    if (bFinished)
+    {
+        UE_LOG(LogVRSProceduralWavStream, Warning, TEXT("AppendAudioBytes after FinishStream; ignoring %d bytes"), Chunk.Num());
+        return true;
+    }
+
+    // The parser holds the scan position across appends; payload spans point
+    // into Chunk and go straight to QueueAudio (which takes its own copy for
+    // the audio render thread).
+    Parser.Feed(Chunk.GetData(), Chunk.Num(), [this](const uint8* Pcm, int32 NumPcmBytes)
+    {
+        if (!ProceduralWave)
+        {
+            CreateWaveFromParsedFormat();
+        }
+        ProceduralWave->QueueAudio(Pcm, NumPcmBytes);
+    });
+
+    if (Parser.HasFailed())
+    {
+        bFailed = true;
+        return false;
+    }
+
+    // A data chunk with no payload bytes yet still makes the stream playable.
+    if (!ProceduralWave && Parser.HasFoundData())
+    {
+        CreateWaveFromParsedFormat();
+    }
+
+    return true;
+}
+
+void UVRSProceduralWavStream::FinishStream()
+{
+    bFinished = true;
+
+    if (!bHeaderParsed && !bFailed)
+    {
+        UE_LOG(LogVRSProceduralWavStream, Warning,
+               TEXT("Stream finished before a complete WAV header arrived (%d bytes staged)"),
+               Parser.GetBufferedByteCount());
+        bFailed = true;
+    }
+}
+
+void UVRSProceduralWavStream::CreateWaveFromParsedFormat()
+{
+    SampleRate = Parser.GetSampleRate();
+    NumChannels = Parser.GetNumChannels();
+
+    ProceduralWave = NewObject<USoundWaveProcedural>(this, NAME_None, RF_Transient);
+    ProceduralWave->SetSampleRate(SampleRate);
+    ProceduralWave->NumChannels = NumChannels;
+    ProceduralWave->SampleByteSize = 2;
+    ProceduralWave->Duration = INDEFINITELY_LOOPING_DURATION;
+    ProceduralWave->SoundGroup = SOUNDGROUP_Voice;
+    ProceduralWave->bLooping = false;
+
+    bHeaderParsed = true;
+
+    const int64 DeclaredDataSize = Parser.GetDeclaredDataSize();
+    UE_LOG(LogVRSProceduralWavStream, Log,
+           TEXT("Stream header parsed: %d Hz, %d channels, data size %s"),
+           SampleRate, NumChannels,
+           DeclaredDataSize == INDEX_NONE ? TEXT("unbounded") : *FString::Printf(TEXT("%lld"), DeclaredDataSize));
+}
@@ -0,0 +1,103 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSSegmentedAudioStream.h"
+#include "Audio/VRSAudioDecoder.h"
+#include "Audio/VRSBase64.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRSSegmentedAudioStream, Log, All);
+
+bool UVRSSegmentedAudioStream::AppendSegment(int32 SegmentIndex, const TArray<uint8>& AudioBytes, bool bLast)
+{
+    if (SegmentIndex < NextSegmentIndex || HeldSegments.Contains(SegmentIndex))
+    {
+        UE_LOG(LogVRSSegmentedAudioStream, Warning,
+               TEXT("Duplicate segment %d ignored"), SegmentIndex);
+        return true;
+    }
+
+    if (bLast)
+    {
+        LastSegmentIndex = SegmentIndex;
+    }
+
+    if (SegmentIndex != NextSegmentIndex)
+    {
+        // Ahead of its predecessors: hold until the gap closes.
+        HeldSegments.Add(SegmentIndex, AudioBytes);
+        return true;
+    }
+
+    const bool bDecoded = DecodeAndQueue(AudioBytes);
+    ++NextSegmentIndex;
+    DrainHeldSegments();
+    return bDecoded;
+}
+
+bool UVRSSegmentedAudioStream::AppendSegmentBase64(int32 SegmentIndex, const FString& AudioBase64, bool bLast)
+{
+    TArray<uint8> AudioBytes;
+    if (!AudioBase64.IsEmpty() && !VRSBase64::Decode(AudioBase64, AudioBytes))
+    {
+        UE_LOG(LogVRSSegmentedAudioStream, Error,
+               TEXT("Segment %d is not valid base64"), SegmentIndex);
+        AudioBytes.Reset();
+    }
+    return AppendSegment(SegmentIndex, AudioBytes, bLast);
+}
+
+bool UVRSSegmentedAudioStream::DecodeAndQueue(const TArray<uint8>& AudioBytes)
+{
+    if (AudioBytes.Num() == 0)
+    {
+        // A failed TTS segment on the gateway; skip it but keep the sequence
+        // moving so later sentences still play.
+        return true;
+    }
+
+    FVRSDecodedWav Decoded;
+    if (!UVRSAudioDecoder::DecodeAudioBytesInternal(AudioBytes, Decoded))
+    {
+        UE_LOG(LogVRSSegmentedAudioStream, Error, TEXT("Segment failed to decode; skipping"));
+        return false;
+    }
+
+    if (!ProceduralWave)
+    {
+        SampleRate = Decoded.SampleRate;
+        NumChannels = Decoded.NumChannels;
+
+        ProceduralWave = NewObject<USoundWaveProcedural>(this, NAME_None, RF_Transient);
+        ProceduralWave->SetSampleRate(SampleRate);
+        ProceduralWave->NumChannels = NumChannels;
+        ProceduralWave->SampleByteSize = 2;
+        ProceduralWave->Duration = INDEFINITELY_LOOPING_DURATION;
+        ProceduralWave->SoundGroup = SOUNDGROUP_Voice;
+        ProceduralWave->bLooping = false;
+    }
+    else if (Decoded.SampleRate != SampleRate || Decoded.NumChannels != NumChannels)
+    {
+        // One TTS voice produces one format; a mismatch would pitch-shift.
+        UE_LOG(LogVRSSegmentedAudioStream, Warning,
+               TEXT("Segment format %d Hz/%d ch differs from stream %d Hz/%d ch; queuing anyway"),
+               Decoded.SampleRate, Decoded.NumChannels, SampleRate, NumChannels);
+    }
+
+    ProceduralWave->QueueAudio(Decoded.GetPcmData(), Decoded.GetPcmNumBytes());
+    return true;
+}
+
+void UVRSSegmentedAudioStream::DrainHeldSegments()
+{
+    TArray<uint8> Held;
+    while (HeldSegments.RemoveAndCopyValue(NextSegmentIndex, Held))
+    {
+        DecodeAndQueue(Held);
+        ++NextSegmentIndex;
+    }
+
+    if (LastSegmentIndex != INDEX_NONE && NextSegmentIndex > LastSegmentIndex)
+    {
+        bComplete = true;
+        HeldSegments.Empty();
+    }
+}
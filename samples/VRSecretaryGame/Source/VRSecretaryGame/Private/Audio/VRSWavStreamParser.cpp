@@ -0,0 +1,203 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#include "Audio/VRSWavStreamParser.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRSWavParser, Log, All);
+
+namespace
+{
+    int32 ReadInt32LE(const uint8* Data)
+    {
+        return (int32)Data[0] | ((int32)Data[1] << 8) |
+               ((int32)Data[2] << 16) | ((int32)Data[3] << 24);
+    }
+
+    int16 ReadInt16LE(const uint8* Data)
+    {
+        return (int16)Data[0] | ((int16)Data[1] << 8);
+    }
+
+    bool IdIs(const uint8* Data, const char* Id)
+    {
+        return Data[0] == Id[0] && Data[1] == Id[1] &&
+               Data[2] == Id[2] && Data[3] == Id[3];
+    }
+}
+
+void FVRSWavStreamParser::Feed(const uint8* Bytes, int32 NumBytes,
+                               TFunctionRef<void(const uint8*, int32)> OnPcmSpan)
+{
+    int32 Cursor = 0;
+
+    while (Cursor < NumBytes && State != EState::Failed)
+    {
+        switch (State)
+        {
+        case EState::Preamble:
+        {
+            if (!Stage(Bytes, NumBytes, Cursor, 12))
+            {
+                return;
+            }
+
+            if (!IdIs(Stash.GetData(), "RIFF") || !IdIs(Stash.GetData() + 8, "WAVE"))
+            {
+                UE_LOG(LogVRSWavParser, Error, TEXT("Invalid WAV: missing RIFF/WAVE preamble"));
+                State = EState::Failed;
+                return;
+            }
+
+            Stash.Reset();
+            State = EState::ChunkHeader;
+            break;
+        }
+
+        case EState::ChunkHeader:
+        {
+            if (!Stage(Bytes, NumBytes, Cursor, 8))
+            {
+                return;
+            }
+
+            // Chunk sizes are unsigned on the wire; widen before arithmetic
+            // so a corrupt size cannot overflow the skip counters.
+            CurrentChunkSize = (int64)(uint32)ReadInt32LE(Stash.GetData() + 4);
+
+            if (IdIs(Stash.GetData(), "fmt "))
+            {
+                if (CurrentChunkSize < 16)
+                {
+                    UE_LOG(LogVRSWavParser, Error, TEXT("Invalid WAV: fmt chunk too small"));
+                    State = EState::Failed;
+                    return;
+                }
+                Stash.Reset();
+                State = EState::FmtBody;
+            }
+            else if (IdIs(Stash.GetData(), "data"))
+            {
+                if (!bHaveFmt)
+                {
+                    UE_LOG(LogVRSWavParser, Error, TEXT("Invalid WAV: data chunk before fmt"));
+                    State = EState::Failed;
+                    return;
+                }
+
+                // Chunked TTS writers often emit a 0 or 0xFFFFFFFF
+                // placeholder size because the final length is unknown;
+                // treat those as unbounded.
+                DeclaredDataSize = (CurrentChunkSize == 0 || CurrentChunkSize == 0xFFFFFFFFll)
+                    ? INDEX_NONE
+                    : CurrentChunkSize;
+                DataBytesRemaining = DeclaredDataSize;
+                bFoundData = true;
+                Stash.Reset();
+                State = EState::DataSpans;
+            }
+            else
+            {
+                // Unknown chunk: discard its body plus the RIFF pad byte for
+                // odd sizes, without buffering any of it.
+                SkipBytesRemaining = CurrentChunkSize + (CurrentChunkSize & 1);
+                Stash.Reset();
+                State = SkipBytesRemaining > 0 ? EState::SkipChunk : EState::ChunkHeader;
+            }
+            break;
+        }
+
+        case EState::FmtBody:
+        {
+            // Only the first 16 bytes carry the PCM format; any extension
+            // bytes are skipped like an unknown chunk tail.
+            if (!Stage(Bytes, NumBytes, Cursor, 16))
+            {
+                return;
+            }
+
+            const int16 AudioFormat = ReadInt16LE(Stash.GetData());
+            if (AudioFormat != 1)
+            {
+                UE_LOG(LogVRSWavParser, Error,
+                       TEXT("Unsupported WAV format: %d (only PCM=1 supported)"), (int32)AudioFormat);
+                State = EState::Failed;
+                return;
+            }
+
+            NumChannels = ReadInt16LE(Stash.GetData() + 2);
+            SampleRate = ReadInt32LE(Stash.GetData() + 4);
+            BitsPerSample = ReadInt16LE(Stash.GetData() + 14);
+
+            // Any sane rate is accepted — the decoder resamples to the
+            // device rate — but a nonsense value still fails fast.
+            if (BitsPerSample != 16 || NumChannels < 1 || NumChannels > 2 ||
+                SampleRate < 4000 || SampleRate > 192000)
+            {
+                UE_LOG(LogVRSWavParser, Error,
+                       TEXT("Unsupported stream format: %d Hz, %d channels, %d bits"),
+                       SampleRate, NumChannels, BitsPerSample);
+                State = EState::Failed;
+                return;
+            }
+
+            bHaveFmt = true;
+            Stash.Reset();
+            SkipBytesRemaining = (CurrentChunkSize - 16) + (CurrentChunkSize & 1);
+            State = SkipBytesRemaining > 0 ? EState::SkipChunk : EState::ChunkHeader;
+            break;
+        }
+
+        case EState::SkipChunk:
+        {
+            const int32 Take = (int32)FMath::Min<int64>(NumBytes - Cursor, SkipBytesRemaining);
+            Cursor += Take;
+            SkipBytesRemaining -= Take;
+            if (SkipBytesRemaining == 0)
+            {
+                State = EState::ChunkHeader;
+            }
+            break;
+        }
+
+        case EState::DataSpans:
+        {
+            const int64 Available = NumBytes - Cursor;
+            const int32 Take = (int32)((DataBytesRemaining == INDEX_NONE)
+                ? Available
+                : FMath::Min<int64>(Available, DataBytesRemaining));
+
+            if (Take > 0)
+            {
+                OnPcmSpan(Bytes + Cursor, Take);
+                Cursor += Take;
+            }
+
+            if (DataBytesRemaining != INDEX_NONE)
+            {
+                DataBytesRemaining -= Take;
+                if (DataBytesRemaining == 0)
+                {
+                    // Bounded payload consumed; trailing chunks (LIST, etc.)
+                    // are walked and skipped like any other unknown chunk.
+                    SkipBytesRemaining = DeclaredDataSize & 1;
+                    State = SkipBytesRemaining > 0 ? EState::SkipChunk : EState::ChunkHeader;
+                }
+            }
+            break;
+        }
+
+        case EState::Failed:
+            return;
+        }
+    }
+}
+
+bool FVRSWavStreamParser::Stage(const uint8* Bytes, int32 NumBytes, int32& Cursor, int32 Needed)
+{
+    const int32 Take = FMath::Min(Needed - Stash.Num(), NumBytes - Cursor);
+    if (Take > 0)
+    {
+        Stash.Append(Bytes + Cursor, Take);
+        Cursor += Take;
+    }
+    return Stash.Num() == Needed;
+}
@@ -5,8 +5,58 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Sound/SoundWave.h"
+#include "Audio/VRSAudioEnvelope.h"
 #include "VRSAudioDecoder.generated.h"
 
+/**
+ * Completion callback for the async decode entry points.
+ * Always invoked on the game thread; SoundWave is nullptr on decode failure.
+ */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FVRSOnSoundWaveDecoded, USoundWave*, SoundWave);
+
+/**
+ * Completion callback for the envelope-extracting async decode. Same
+ * threading contract as FVRSOnSoundWaveDecoded; the envelope is empty when
+ * decoding failed.
+ */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FVRSOnSoundWaveDecodedWithEnvelope,
+                                   USoundWave*, SoundWave,
+                                   FVRSLipSyncEnvelope, Envelope);
+
+/**
+ * Intermediate result of the thread-safe decode stage: validated audio
+ * parameters plus the extracted PCM payload. Contains no UObjects, so it can
+ * be produced on any thread and handed to the game thread for USoundWave
+ * creation.
+ */
+struct FVRSDecodedWav
+{
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+
+    /**
+     * Backing bytes with the PCM payload as an offset view into them. When
+     * the decode entry point owns its input (the move overloads), the whole
+     * WAV buffer is adopted here with the view skipping the header — zero
+     * staging copies; otherwise Backing is a pooled buffer holding just the
+     * payload at offset 0.
+     */
+    TArray<uint8> Backing;
+    int32 PcmOffset = 0;
+    int32 PcmNumBytes = 0;
+
+    const uint8* GetPcmData() const { return Backing.GetData() + PcmOffset; }
+    int32 GetPcmNumBytes() const { return PcmNumBytes; }
+
+    /** Adopt a pooled/owned buffer whose payload spans the whole buffer. */
+    void AdoptWholeBuffer(TArray<uint8>&& InBytes)
+    {
+        Backing = MoveTemp(InBytes);
+        PcmOffset = 0;
+        PcmNumBytes = Backing.Num();
+    }
+};
+
 /**
  * Audio decoder for VRSecretary TTS responses.
  * Converts Base64-encoded WAV audio into USoundWave objects for playback.
@@ -25,41 +75,184 @@ public:
      * 
      * Requirements:
      * - Input must be valid Base64 WAV (PCM 16-bit, mono/stereo)
-     * - Supports 8000-48000 Hz sample rates
+     * - Any sane sample rate; audio is resampled to the device rate once
+     *   at decode time so the mixer plays it back without per-frame SRC
      * - Max size: ~10MB decoded (prevents memory issues)
      */
-    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio", 
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
               meta = (DisplayName = "Decode Base64 WAV to Sound Wave"))
     static USoundWave* DecodeBase64WavToSoundWave(const FString& Base64String);
 
+    /**
+     * Decode raw WAV bytes into a playable USoundWave.
+     *
+     * This is the binary-transport path: bytes arriving from the component's
+     * OnAssistantAudioReady event (audio_url mode) can be handed straight in,
+     * skipping the base64 decode entirely.
+     *
+     * @param WavData - Raw WAV file bytes (PCM 16-bit, mono/stereo)
+     * @return USoundWave ready for playback, or nullptr on error
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode WAV Bytes to Sound Wave"))
+    static USoundWave* DecodeWavBytesToSoundWave(const TArray<uint8>& WavData);
+
+    /**
+     * Async variant of DecodeBase64WavToSoundWave: base64 decode, WAV parsing
+     * and the PCM copy run on the task graph instead of the calling thread,
+     * so decoding a reply never hitches the game thread (a full decode is
+     * 20-40 ms for long utterances — a dropped frame at 90 Hz).
+     *
+     * @param Base64String - Base64-encoded WAV audio from backend
+     * @param OnDecoded - Called on the game thread with the finished
+     *                    USoundWave, or nullptr if decoding failed
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode Base64 WAV to Sound Wave (Async)"))
+    static void DecodeBase64WavToSoundWaveAsync(const FString& Base64String,
+                                                const FVRSOnSoundWaveDecoded& OnDecoded);
+
+    /**
+     * Async variant of DecodeWavBytesToSoundWave for the binary transport
+     * path. Same threading contract as DecodeBase64WavToSoundWaveAsync.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode WAV Bytes to Sound Wave (Async)"))
+    static void DecodeWavBytesToSoundWaveAsync(const TArray<uint8>& WavData,
+                                               const FVRSOnSoundWaveDecoded& OnDecoded);
+
+    /**
+     * C++ move overload: adopts the caller's buffer into the decode job, so
+     * the PCM is never staged — the only copy left is the engine-mandated
+     * one into USoundWave::RawPCMData. Use from handlers that own their
+     * bytes (e.g. a response body about to be discarded).
+     */
+    static void DecodeWavBytesToSoundWaveAsync(TArray<uint8>&& WavData,
+                                               const FVRSOnSoundWaveDecoded& OnDecoded);
+
+    /**
+     * Decode a Base64-encoded Ogg Opus clip into a playable USoundWave.
+     * Opus is ~10x smaller than PCM WAV at the same voice quality; pair this
+     * with the component advertising "opus" in its accepted codecs so the
+     * gateway ships the compressed form. Fails (nullptr) on platforms built
+     * without Opus support.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode Base64 Opus to Sound Wave"))
+    static USoundWave* DecodeBase64OpusToSoundWave(const FString& Base64String);
+
+    /**
+     * Codec-agnostic decode: sniffs the container magic ("RIFF" = WAV,
+     * "OggS" = Ogg Opus) and routes to the matching decoder, so callers
+     * don't need to know which codec the gateway negotiated.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode Audio Bytes to Sound Wave"))
+    static USoundWave* DecodeAudioBytesToSoundWave(const TArray<uint8>& AudioData);
+
+    /**
+     * Async variant of DecodeAudioBytesToSoundWave. Same threading contract
+     * as DecodeBase64WavToSoundWaveAsync.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode Audio Bytes to Sound Wave (Async)"))
+    static void DecodeAudioBytesToSoundWaveAsync(const TArray<uint8>& AudioData,
+                                                 const FVRSOnSoundWaveDecoded& OnDecoded);
+
+    /** C++ move overload; see DecodeWavBytesToSoundWaveAsync(TArray&&). */
+    static void DecodeAudioBytesToSoundWaveAsync(TArray<uint8>&& AudioData,
+                                                 const FVRSOnSoundWaveDecoded& OnDecoded);
+
+    /** C++ move overload of the synchronous codec-agnostic decode. */
+    static USoundWave* DecodeAudioBytesToSoundWave(TArray<uint8>&& AudioData);
+
+    /**
+     * Decode a Base64-encoded WAV and extract a lip-sync envelope in the
+     * same pass, while the PCM is still hot in cache. EnvelopeWindowMs sets
+     * the analysis window (10 ms ≈ 100 values/second; clamped to 1-1000).
+     * Sample the result with GetEnvelopeLevelAtTime from the animation tick
+     * instead of re-reading the PCM.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode Base64 WAV to Sound Wave (With Envelope)"))
+    static USoundWave* DecodeBase64WavToSoundWaveWithEnvelope(const FString& Base64String,
+                                                              float EnvelopeWindowMs,
+                                                              FVRSLipSyncEnvelope& OutEnvelope);
+
+    /**
+     * Async, codec-agnostic decode that also extracts the lip-sync envelope
+     * on the task graph. Container sniffing as in DecodeAudioBytesToSoundWave.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Decode Audio Bytes to Sound Wave (With Envelope, Async)"))
+    static void DecodeAudioBytesToSoundWaveWithEnvelopeAsync(const TArray<uint8>& AudioData,
+                                                             float EnvelopeWindowMs,
+                                                             const FVRSOnSoundWaveDecodedWithEnvelope& OnDecoded);
+
+    /**
+     * Linearly interpolated RMS level of the envelope at a playback time, in
+     * [0, 1]. Cheap enough to call per animation tick; drives mouth-open
+     * amount directly or a viseme blend.
+     */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Get Envelope Level At Time"))
+    static float GetEnvelopeLevelAtTime(const FVRSLipSyncEnvelope& Envelope, float TimeSeconds);
+
+    /**
+     * Create a progressive-playback stream: append raw WAV bytes as they
+     * arrive from the transport and play the procedural wave as soon as the
+     * header is parsed — the avatar starts speaking while the tail of the
+     * audio is still downloading. See UVRSProceduralWavStream.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Create Streaming WAV Player"))
+    static class UVRSProceduralWavStream* CreateWavStream();
+
+    /**
+     * Create an ordered playback stream for pipelined-TTS replies: feed the
+     * numbered segments from OnAssistantAudioSegment in and play the single
+     * procedural wave — sentences stitch back-to-back with no seams. See
+     * UVRSSegmentedAudioStream.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio",
+              meta = (DisplayName = "Create Segmented Audio Player"))
+    static class UVRSSegmentedAudioStream* CreateSegmentedStream();
+
 private:
+    /** Segmented playback decodes through DecodeAudioBytesInternal. */
+    friend class UVRSSegmentedAudioStream;
+
     /**
-     * Parse WAV header to extract audio parameters.
-     * 
-     * @param WavData - Raw WAV file bytes
-     * @param OutSampleRate - Extracted sample rate (Hz)
-     * @param OutNumChannels - Extracted channel count (1=mono, 2=stereo)
-     * @param OutBitsPerSample - Bits per sample (8, 16, 24, 32)
-     * @param OutDataOffset - Offset to audio data in bytes
-     * @param OutDataSize - Size of audio data in bytes
-     * @return true if header parsed successfully
+     * Thread-safe decode stage: validates the WAV container and extracts the
+     * PCM payload. Touches no UObjects, so it may run on any thread.
+     */
+    static bool DecodeWavBytesInternal(const TArray<uint8>& WavData, FVRSDecodedWav& OutDecoded);
+
+    /**
+     * Owned-input variant: adopts WavData as the decode result's backing
+     * buffer instead of copying the payload into pooled staging.
      */
-    static bool ParseWavHeader(
-        const TArray<uint8>& WavData,
-        int32& OutSampleRate,
-        int32& OutNumChannels,
-        int32& OutBitsPerSample,
-        int32& OutDataOffset,
-        int32& OutDataSize
-    );
+    static bool DecodeWavBytesInternal(TArray<uint8>&& WavData, FVRSDecodedWav& OutDecoded);
+
+    /**
+     * Thread-safe container-sniffing decode stage backing the unified entry
+     * points: WAV and Ogg Opus both land in an FVRSDecodedWav.
+     */
+    static bool DecodeAudioBytesInternal(const TArray<uint8>& AudioData, FVRSDecodedWav& OutDecoded);
+
+    /** Owned-input variant of the container-sniffing stage. */
+    static bool DecodeAudioBytesInternal(TArray<uint8>&& AudioData, FVRSDecodedWav& OutDecoded);
 
     /**
-     * Read 32-bit integer from byte array (little-endian).
+     * One-shot conversion of freshly decoded PCM to the mixer's output rate
+     * (see VRSAudioResample), so playing instances skip per-frame mixer
+     * resampling. Best effort: leaves the source rate on failure.
      */
-    static int32 ReadInt32(const TArray<uint8>& Data, int32 Offset);
+    static void ResampleToDeviceRate(FVRSDecodedWav& Decoded);
 
     /**
-     * Read 16-bit integer from byte array (little-endian).
+     * Game-thread stage: wraps an already-decoded PCM payload in a transient
+     * USoundWave.
      */
-    static int16 ReadInt16(const TArray<uint8>& Data, int32 Offset);
+    static USoundWave* CreateSoundWaveFromDecoded(FVRSDecodedWav&& Decoded);
 };
\ No newline at end of file
@@ -0,0 +1,42 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VRSAudioEnvelope.generated.h"
+
+/**
+ * Compact lip-sync envelope extracted from TTS audio during decode: one RMS
+ * and one peak level per fixed-length window, normalized to [0, 1]. Drives
+ * the avatar's mouth directly (amplitude) or feeds a viseme mapper, without
+ * the animation tick ever touching the PCM again.
+ */
+USTRUCT(BlueprintType)
+struct FVRSLipSyncEnvelope
+{
+    GENERATED_BODY()
+
+    /** Window length the envelope was computed with, in seconds. */
+    UPROPERTY(BlueprintReadOnly, Category="VRSecretary|Audio")
+    float WindowSeconds = 0.0f;
+
+    /** RMS level per window, normalized to [0, 1]. */
+    UPROPERTY(BlueprintReadOnly, Category="VRSecretary|Audio")
+    TArray<float> RMS;
+
+    /** Peak absolute sample per window, normalized to [0, 1]. */
+    UPROPERTY(BlueprintReadOnly, Category="VRSecretary|Audio")
+    TArray<float> Peak;
+};
+
+namespace VRSAudioEnvelope
+{
+    /**
+     * One pass over interleaved 16-bit PCM computing the per-window RMS and
+     * peak, vectorized (SSE2/NEON) where available. Channels are folded
+     * together — lip sync wants overall loudness, not a stereo image.
+     * Thread-safe; WindowMs is clamped to [1, 1000].
+     */
+    void Compute(const int16* Samples, int32 NumSamples, int32 NumChannels,
+                 int32 SampleRate, float WindowMs, FVRSLipSyncEnvelope& OutEnvelope);
+}
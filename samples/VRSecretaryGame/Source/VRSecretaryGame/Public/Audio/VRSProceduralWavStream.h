@@ -0,0 +1,73 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundWaveProcedural.h"
+#include "Audio/VRSWavStreamParser.h"
+#include "VRSProceduralWavStream.generated.h"
+
+/**
+ * Progressive playback for a WAV stream that is still being received.
+ *
+ * Feed transport chunks in with AppendAudioBytes as they arrive; the header
+ * is parsed incrementally by FVRSWavStreamParser (each byte scanned exactly
+ * once, however the transport fragments it), and once the format is known
+ * the PCM payload is queued into an internal USoundWaveProcedural. Playback
+ * can therefore start after the first chunk instead of waiting for the full
+ * utterance to download and decode.
+ *
+ * Typical flow:
+ *   1. Create via UVRSAudioDecoder::CreateWavStream.
+ *   2. AppendAudioBytes for every chunk from the transport.
+ *   3. Start playing GetSoundWave() as soon as IsReadyForPlayback().
+ *   4. Call FinishStream when the transport completes.
+ */
+UCLASS(BlueprintType)
+class VRSECRETARYGAME_API UVRSProceduralWavStream : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Append the next chunk of raw WAV bytes (header included — just forward
+     * the transport bytes in order). Safe to call with chunks of any size.
+     *
+     * @return false if the stream is in a failed state (bad header)
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio")
+    bool AppendAudioBytes(const TArray<uint8>& Chunk);
+
+    /** Mark the stream complete; no further chunks will be queued. */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio")
+    void FinishStream();
+
+    /** The procedural wave to play; valid once IsReadyForPlayback(). */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio")
+    USoundWaveProcedural* GetSoundWave() const { return ProceduralWave; }
+
+    /** True once the WAV header has been parsed and audio can be played. */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio")
+    bool IsReadyForPlayback() const { return bHeaderParsed; }
+
+    /** Sample rate from the parsed header (0 until ready). */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio")
+    int32 GetSampleRate() const { return SampleRate; }
+
+private:
+    UPROPERTY(Transient)
+    TObjectPtr<USoundWaveProcedural> ProceduralWave;
+
+    /** Carries the scan position across appends; payload comes out as spans. */
+    FVRSWavStreamParser Parser;
+
+    bool bHeaderParsed = false;
+    bool bFailed = false;
+    bool bFinished = false;
+
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+
+    /** Create the procedural wave once the parser has reached the data chunk. */
+    void CreateWaveFromParsedFormat();
+};
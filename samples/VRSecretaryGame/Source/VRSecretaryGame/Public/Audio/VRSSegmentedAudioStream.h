@@ -0,0 +1,88 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundWaveProcedural.h"
+#include "VRSSegmentedAudioStream.generated.h"
+
+/**
+ * Ordered, gap-free playback for pipelined-TTS replies.
+ *
+ * The gateway splits long replies into sentences, synthesizes them in
+ * parallel and delivers each as a numbered audio segment (the component's
+ * OnAssistantAudioSegment event). Feed those segments in here: each one is
+ * decoded (WAV or Ogg Opus, sniffed per segment) and its PCM queued into a
+ * single USoundWaveProcedural, so consecutive sentences play back-to-back
+ * with no per-segment AudioComponent churn and no audible seams.
+ *
+ * Segments may arrive in any order; out-of-order ones are held until their
+ * predecessors have been queued, so playback order always matches
+ * SegmentIndex order. Playback can start as soon as the first segment is
+ * queued — time-to-first-audio is bounded by the first sentence alone.
+ *
+ * Typical flow:
+ *   1. Create via UVRSAudioDecoder::CreateSegmentedStream.
+ *   2. AppendSegmentBase64 from OnAssistantAudioSegment.
+ *   3. Start playing GetSoundWave() once IsReadyForPlayback().
+ */
+UCLASS(BlueprintType)
+class VRSECRETARYGAME_API UVRSSegmentedAudioStream : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Append one audio segment (raw WAV or Ogg Opus bytes). Held until all
+     * lower-numbered segments have been queued; duplicates are ignored.
+     *
+     * @return false if the segment could not be decoded
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio")
+    bool AppendSegment(int32 SegmentIndex, const TArray<uint8>& AudioBytes, bool bLast);
+
+    /**
+     * Convenience for the component's OnAssistantAudioSegment event: base64
+     * decode, then AppendSegment. Empty audio (a failed TTS segment on the
+     * gateway) just advances the sequence so later segments aren't stuck.
+     */
+    UFUNCTION(BlueprintCallable, Category = "VRSecretary|Audio")
+    bool AppendSegmentBase64(int32 SegmentIndex, const FString& AudioBase64, bool bLast);
+
+    /** The procedural wave to play; valid once IsReadyForPlayback(). */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio")
+    USoundWaveProcedural* GetSoundWave() const { return ProceduralWave; }
+
+    /** True once the first segment has been decoded and queued. */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio")
+    bool IsReadyForPlayback() const { return ProceduralWave != nullptr; }
+
+    /** True once the last segment (bLast) and all its predecessors queued. */
+    UFUNCTION(BlueprintPure, Category = "VRSecretary|Audio")
+    bool IsComplete() const { return bComplete; }
+
+private:
+    UPROPERTY(Transient)
+    TObjectPtr<USoundWaveProcedural> ProceduralWave;
+
+    /** Segments that arrived ahead of their predecessors, by index. */
+    TMap<int32, TArray<uint8>> HeldSegments;
+
+    /** Next SegmentIndex that may be queued. */
+    int32 NextSegmentIndex = 0;
+
+    /** Index of the segment flagged bLast, or INDEX_NONE until seen. */
+    int32 LastSegmentIndex = INDEX_NONE;
+
+    bool bComplete = false;
+
+    /** Format fixed by the first decoded segment. */
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+
+    /** Decode one in-order segment and queue its PCM. */
+    bool DecodeAndQueue(const TArray<uint8>& AudioBytes);
+
+    /** Queue held segments that have become in-order; updates completion. */
+    void DrainHeldSegments();
+};
@@ -0,0 +1,101 @@
+// Copyright 2025 VRSecretary Project. Licensed under Apache 2.0.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Incremental RIFF/WAVE parser shared by the whole-buffer decoder
+ * (UVRSAudioDecoder) and progressive playback (UVRSProceduralWavStream).
+ *
+ * A state machine (preamble → chunk walk → fmt → data) that can be fed
+ * buffers of any size: every byte handed to Feed is consumed exactly once
+ * and the scan position survives across feeds, so per-chunk cost is
+ * O(chunk) regardless of how the transport fragments the file. PCM payload
+ * is surfaced as spans pointing into the caller's buffer — never copied.
+ * The only internal staging is for header bytes that straddle a feed
+ * boundary, bounded at a few dozen bytes.
+ *
+ * Accepts the out-of-spec payloads real TTS backends emit: extra chunks
+ * before or after data are skipped, odd chunk sizes honor the RIFF pad
+ * byte, and a 0 or 0xFFFFFFFF placeholder data size (chunked writers that
+ * cannot know the final length) is treated as unbounded.
+ *
+ * Only PCM16 with 1-2 channels is accepted; any sane sample rate
+ * (4000-192000 Hz) passes, since the decoder resamples to the device rate.
+ * Anything else puts the parser in the failed state.
+ */
+class VRSECRETARYGAME_API FVRSWavStreamParser
+{
+public:
+    /**
+     * Consume the next transport bytes. OnPcmSpan is invoked zero or more
+     * times with spans of data-chunk payload inside [Bytes, Bytes+NumBytes);
+     * the spans are only valid for the duration of the call. Feeding after
+     * failure is a no-op.
+     */
+    void Feed(const uint8* Bytes, int32 NumBytes,
+              TFunctionRef<void(const uint8* Pcm, int32 NumPcmBytes)> OnPcmSpan);
+
+    /** True once malformed or unsupported input was seen; parsing stops. */
+    bool HasFailed() const { return State == EState::Failed; }
+
+    /** True once the fmt chunk has been parsed (format accessors valid). */
+    bool HasFormat() const { return bHaveFmt; }
+
+    /** True once the data chunk has been reached; payload spans follow. */
+    bool HasFoundData() const { return bFoundData; }
+
+    int32 GetSampleRate() const { return SampleRate; }
+    int32 GetNumChannels() const { return NumChannels; }
+    int32 GetBitsPerSample() const { return BitsPerSample; }
+
+    /**
+     * The data chunk's declared payload size in bytes, or INDEX_NONE when
+     * the producer streamed a placeholder size. Valid once HasFoundData().
+     */
+    int64 GetDeclaredDataSize() const { return DeclaredDataSize; }
+
+    /** Header bytes staged while waiting for a feed to complete them. */
+    int32 GetBufferedByteCount() const { return Stash.Num(); }
+
+private:
+    enum class EState : uint8
+    {
+        Preamble,    // expecting "RIFF" + size + "WAVE" (12 bytes)
+        ChunkHeader, // expecting a chunk id + size (8 bytes)
+        FmtBody,     // expecting the first 16 bytes of the fmt chunk
+        SkipChunk,   // discarding SkipBytesRemaining bytes
+        DataSpans,   // emitting payload spans
+        Failed,
+    };
+
+    /**
+     * Stage input into Stash until it holds Needed bytes. Returns false when
+     * the feed ran out first (resume on the next feed).
+     */
+    bool Stage(const uint8* Bytes, int32 NumBytes, int32& Cursor, int32 Needed);
+
+    EState State = EState::Preamble;
+
+    /** Header bytes straddling a feed boundary; payload never lands here. */
+    TArray<uint8> Stash;
+
+    bool bHaveFmt = false;
+    bool bFoundData = false;
+
+    int32 SampleRate = 0;
+    int32 NumChannels = 0;
+    int32 BitsPerSample = 0;
+
+    /** Declared size of the chunk currently being handled. */
+    int64 CurrentChunkSize = 0;
+
+    /** Bytes left to discard while in SkipChunk. */
+    int64 SkipBytesRemaining = 0;
+
+    int64 DeclaredDataSize = INDEX_NONE;
+
+    /** Payload bytes still expected, or INDEX_NONE when unbounded. */
+    int64 DataBytesRemaining = INDEX_NONE;
+};
@@ -17,6 +17,25 @@ public class VRSecretaryGame : ModuleRules
             "SlateCore"
         });
 
-        PrivateDependencyModuleNames.AddRange(new string[] { });
+        // SignalProcessing supplies the vectorized int16<->float conversion
+        // and the sinc resampler used to match TTS audio to the mixer rate
+        // once at decode time.
+        PrivateDependencyModuleNames.AddRange(new string[] {
+            "SignalProcessing"
+        });
+
+        // Compressed TTS audio: decode Ogg Opus with the engine's bundled
+        // libopus on platforms that ship it. VRS_WITH_OPUS gates the decoder
+        // so the rest keep building (Opus decode just fails with a log).
+        bool bWithOpus =
+            Target.Platform == UnrealTargetPlatform.Win64 ||
+            Target.Platform == UnrealTargetPlatform.Mac ||
+            Target.Platform == UnrealTargetPlatform.Linux ||
+            Target.Platform == UnrealTargetPlatform.Android;
+        if (bWithOpus)
+        {
+            AddEngineThirdPartyPrivateStaticDependencies(Target, "libOpus");
+        }
+        PrivateDefinitions.Add("VRS_WITH_OPUS=" + (bWithOpus ? "1" : "0"));
     }
 }